@@ -0,0 +1,30 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class DanzmannGameplayMessagesAI : ModuleRules
+{
+	public DanzmannGameplayMessagesAI(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"AIModule",
+				"Core",
+				"DanzmannGameplayMessages",
+				"Engine",
+				"GameplayTags",
+				"StateTreeModule"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject"
+			}
+		);
+	}
+}
@@ -0,0 +1,128 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannBTDecorator_GameplayMessage.h"
+#include "AIController.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "Engine/World.h"
+
+namespace DanzmannGameplayMessages::Private
+{
+	struct FBTDecoratorGameplayMessageMemory
+	{
+		/**
+		 * Subscription to AI router, valid while decorator is relevant.
+		 */
+		FDanzmannGameplayMessagesAISubscriptionHandle SubscriptionHandle;
+
+		/**
+		 * World time last Gameplay Message was received at, negative if none.
+		 */
+		double ReceivedTime = -1.0;
+	};
+}
+
+UDanzmannBTDecorator_GameplayMessage::UDanzmannBTDecorator_GameplayMessage()
+{
+	NodeName = TEXT("Gameplay Message Received");
+
+	bNotifyBecomeRelevant = true;
+	bNotifyCeaseRelevant = true;
+
+	// Only ticks when retention time runs out, never every frame
+	bNotifyTick = true;
+	bTickIntervals = true;
+}
+
+uint16 UDanzmannBTDecorator_GameplayMessage::GetInstanceMemorySize() const
+{
+	return sizeof(DanzmannGameplayMessages::Private::FBTDecoratorGameplayMessageMemory);
+}
+
+void UDanzmannBTDecorator_GameplayMessage::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
+{
+	InitializeNodeMemory<DanzmannGameplayMessages::Private::FBTDecoratorGameplayMessageMemory>(NodeMemory, InitType);
+}
+
+void UDanzmannBTDecorator_GameplayMessage::CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const
+{
+	CleanupNodeMemory<DanzmannGameplayMessages::Private::FBTDecoratorGameplayMessageMemory>(NodeMemory, CleanupType);
+}
+
+FString UDanzmannBTDecorator_GameplayMessage::GetStaticDescription() const
+{
+	return FString::Printf(TEXT("%s: %s"), *Super::GetStaticDescription(), *Channel.ToString());
+}
+
+bool UDanzmannBTDecorator_GameplayMessage::CalculateRawConditionValue(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) const
+{
+	const DanzmannGameplayMessages::Private::FBTDecoratorGameplayMessageMemory* Memory = CastInstanceNodeMemory<DanzmannGameplayMessages::Private::FBTDecoratorGameplayMessageMemory>(NodeMemory);
+	const UWorld* World = OwnerComp.GetWorld();
+	return (Memory->ReceivedTime >= 0.0) && (World != nullptr) && ((World->GetTimeSeconds() - Memory->ReceivedTime) <= RetentionTime);
+}
+
+void UDanzmannBTDecorator_GameplayMessage::OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	DanzmannGameplayMessages::Private::FBTDecoratorGameplayMessageMemory* Memory = CastInstanceNodeMemory<DanzmannGameplayMessages::Private::FBTDecoratorGameplayMessageMemory>(NodeMemory);
+	SetNextTickTime(NodeMemory, FLT_MAX);
+
+	UDanzmannGameplayMessagesAIRouter* Router = UDanzmannGameplayMessagesAIRouter::Get(&OwnerComp);
+	if (Router == nullptr)
+	{
+		return;
+	}
+
+	const AAIController* AIController = OwnerComp.GetAIOwner();
+	const AActor* Target = (AIController != nullptr) && (AIController->GetPawn() != nullptr) ? static_cast<const AActor*>(AIController->GetPawn()) : OwnerComp.GetOwner();
+
+	// Shared by every instance of this behavior tree listening to the same channel
+	FDanzmannGameplayMessagesAIBindingKey BindingKey;
+	BindingKey.Channel = Channel;
+	BindingKey.ChannelMatchCriteria = ChannelMatchCriteria;
+	BindingKey.Asset = GetTreeAsset();
+	BindingKey.GameplayMessageStructType = GameplayMessageStructType;
+	BindingKey.TargetPropertyName = TargetPropertyName;
+
+	Memory->SubscriptionHandle = Router->Subscribe(BindingKey, Target,
+		[this, WeakOwnerComp = TWeakObjectPtr<UBehaviorTreeComponent>(&OwnerComp)](const FGameplayTag, const FConstStructView)
+		{
+			if (UBehaviorTreeComponent* StrongOwnerComp = WeakOwnerComp.Get())
+			{
+				HandleGameplayMessage(*StrongOwnerComp);
+			}
+		}
+	);
+}
+
+void UDanzmannBTDecorator_GameplayMessage::OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	DanzmannGameplayMessages::Private::FBTDecoratorGameplayMessageMemory* Memory = CastInstanceNodeMemory<DanzmannGameplayMessages::Private::FBTDecoratorGameplayMessageMemory>(NodeMemory);
+	if (UDanzmannGameplayMessagesAIRouter* Router = UDanzmannGameplayMessagesAIRouter::Get(&OwnerComp))
+	{
+		Router->Unsubscribe(Memory->SubscriptionHandle);
+	}
+}
+
+void UDanzmannBTDecorator_GameplayMessage::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+{
+	// Retention time ran out
+	SetNextTickTime(NodeMemory, FLT_MAX);
+	ConditionalFlowAbort(OwnerComp, EBTDecoratorAbortRequest::ConditionResultChanged);
+}
+
+void UDanzmannBTDecorator_GameplayMessage::HandleGameplayMessage(UBehaviorTreeComponent& OwnerComp)
+{
+	// Node memory is found through behavior tree component, decorator is shared by every instance
+	uint8* NodeMemory = OwnerComp.GetNodeMemory(this, OwnerComp.FindInstanceContainingNode(this));
+	const UWorld* World = OwnerComp.GetWorld();
+	if ((NodeMemory == nullptr) || (World == nullptr))
+	{
+		return;
+	}
+
+	DanzmannGameplayMessages::Private::FBTDecoratorGameplayMessageMemory* Memory = CastInstanceNodeMemory<DanzmannGameplayMessages::Private::FBTDecoratorGameplayMessageMemory>(NodeMemory);
+	Memory->ReceivedTime = World->GetTimeSeconds();
+	SetNextTickTime(NodeMemory, RetentionTime);
+
+	// Flow update is scheduled by behavior tree component, not run from within the broadcast
+	ConditionalFlowAbort(OwnerComp, EBTDecoratorAbortRequest::ConditionResultChanged);
+}
@@ -0,0 +1,17 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesAI.h"
+
+#define LOCTEXT_NAMESPACE "FDanzmannGameplayMessagesAIModule"
+
+void FDanzmannGameplayMessagesAIModule::StartupModule()
+{
+}
+
+void FDanzmannGameplayMessagesAIModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+	
+IMPLEMENT_MODULE(FDanzmannGameplayMessagesAIModule, DanzmannGameplayMessagesAI)
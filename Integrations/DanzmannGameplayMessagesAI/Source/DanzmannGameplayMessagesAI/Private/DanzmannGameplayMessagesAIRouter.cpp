@@ -0,0 +1,230 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesAIRouter.h"
+#include "DanzmannGameplayMessagesGameInstanceSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Pawn.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDanzmannGameplayMessagesAI, Log, All);
+
+void UDanzmannGameplayMessagesAIRouter::Deinitialize()
+{
+	// Scoped listeners unregister themselves
+	Bindings.Empty();
+	BindingIndices.Empty();
+	BindingsToCleanUp.Empty();
+
+	Super::Deinitialize();
+}
+
+UDanzmannGameplayMessagesAIRouter* UDanzmannGameplayMessagesAIRouter::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return IsValid(World) ? World->GetSubsystem<UDanzmannGameplayMessagesAIRouter>() : nullptr;
+}
+
+FDanzmannGameplayMessagesAISubscriptionHandle UDanzmannGameplayMessagesAIRouter::Subscribe(const FDanzmannGameplayMessagesAIBindingKey& BindingKey, const AActor* Target, TFunction<void(const FGameplayTag, const FConstStructView)>&& Callback)
+{
+	if (!ensureMsgf(!bIsRouting, TEXT("Dancing Man Gameplay Messages | AI instances can't subscribe while Gameplay Messages are being routed to them.")))
+	{
+		return FDanzmannGameplayMessagesAISubscriptionHandle();
+	}
+
+	if (!BindingKey.Channel.IsValid() || (Target == nullptr) || !Callback)
+	{
+		UE_LOG(LogDanzmannGameplayMessagesAI, Warning, TEXT("[%hs] Trying to subscribe with an invalid channel, target or callback."), __FUNCTION__);
+		return FDanzmannGameplayMessagesAISubscriptionHandle();
+	}
+
+	// First subscription of binding registers its single listener and resolves its target property
+	const int32* ExistingBindingIndex = BindingIndices.Find(BindingKey);
+	int32 BindingIndex = ExistingBindingIndex != nullptr ? *ExistingBindingIndex : INDEX_NONE;
+	if (BindingIndex == INDEX_NONE)
+	{
+		const UWorld* World = GetWorld();
+		if (!UDanzmannGameplayMessagesGameInstanceSubsystem::HasInstance(World))
+		{
+			return FDanzmannGameplayMessagesAISubscriptionHandle();
+		}
+
+		const UScriptStruct* GameplayMessageStructType = Cast<UScriptStruct>(BindingKey.GameplayMessageStructType.ResolveObjectPtr());
+
+		BindingIndex = Bindings.Emplace();
+		BindingIndices.Add(BindingKey, BindingIndex);
+
+		FBinding& Binding = Bindings[BindingIndex];
+		Binding.Key = BindingKey;
+		if ((GameplayMessageStructType != nullptr) && !BindingKey.TargetPropertyName.IsNone())
+		{
+			const FObjectPropertyBase* TargetProperty = CastField<FObjectPropertyBase>(GameplayMessageStructType->FindPropertyByName(BindingKey.TargetPropertyName));
+			if ((TargetProperty != nullptr) && TargetProperty->PropertyClass->IsChildOf<AActor>())
+			{
+				Binding.TargetProperty = TargetProperty;
+				Binding.TargetPropertyOwnerStructType = GameplayMessageStructType;
+			}
+			else
+			{
+				UE_LOG(LogDanzmannGameplayMessagesAI, Warning, TEXT("[%hs] %s has no actor property named %s, Gameplay Messages on channel %s are delivered to every AI instance."), __FUNCTION__, *GameplayMessageStructType->GetName(), *BindingKey.TargetPropertyName.ToString(), *BindingKey.Channel.ToString());
+			}
+		}
+
+		UDanzmannGameplayMessagesGameInstanceSubsystem* Subsystem = UDanzmannGameplayMessagesGameInstanceSubsystem::Get(World);
+		Binding.Listener = FDanzmannScopedGameplayMessageListener(Subsystem, Subsystem->RegisterListener(BindingKey.Channel, GameplayMessageStructType,
+			[this, BindingIndex](const FGameplayTag Channel, const FConstStructView GameplayMessage)
+			{
+				HandleGameplayMessage(BindingIndex, Channel, GameplayMessage);
+			},
+			BindingKey.ChannelMatchCriteria
+		));
+	}
+
+	if (++LastSubscriptionId == 0)
+	{
+		// 0 is reserved for invalid handles
+		++LastSubscriptionId;
+	}
+
+	FDanzmannGameplayMessagesAISubscriptionHandle Handle;
+	Handle.BindingIndex = BindingIndex;
+	Handle.SubscriptionId = LastSubscriptionId;
+	Handle.Target = FObjectKey(Target);
+
+	FBinding& Binding = Bindings[BindingIndex];
+	Binding.SubscriptionsByTarget.FindOrAdd(Handle.Target).Add({ Handle.SubscriptionId, MoveTemp(Callback) });
+	++Binding.NumSubscriptions;
+
+	return Handle;
+}
+
+void UDanzmannGameplayMessagesAIRouter::Unsubscribe(FDanzmannGameplayMessagesAISubscriptionHandle& Handle)
+{
+	if (!Handle.IsValid() || !Bindings.IsValidIndex(Handle.BindingIndex))
+	{
+		Handle = FDanzmannGameplayMessagesAISubscriptionHandle();
+		return;
+	}
+
+	FBinding& Binding = Bindings[Handle.BindingIndex];
+	if (TArray<FSubscription, TInlineAllocator<1>>* Subscriptions = Binding.SubscriptionsByTarget.Find(Handle.Target))
+	{
+		const int32 SubscriptionIndex = Subscriptions->IndexOfByPredicate([Id = Handle.SubscriptionId](const FSubscription& Subscription) { return Subscription.Id == Id; });
+		if (SubscriptionIndex != INDEX_NONE)
+		{
+			--Binding.NumSubscriptions;
+
+			if (bIsRouting)
+			{
+				// Subscriptions may be iterated (or even invoked) right now, they're purged once routing is done
+				(*Subscriptions)[SubscriptionIndex].Id = 0;
+				BindingsToCleanUp.AddUnique(Handle.BindingIndex);
+			}
+			else
+			{
+				Subscriptions->RemoveAtSwap(SubscriptionIndex);
+				if (Subscriptions->IsEmpty())
+				{
+					Binding.SubscriptionsByTarget.Remove(Handle.Target);
+				}
+
+				CleanUpBinding(Handle.BindingIndex);
+			}
+		}
+	}
+
+	Handle = FDanzmannGameplayMessagesAISubscriptionHandle();
+}
+
+bool UDanzmannGameplayMessagesAIRouter::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return (WorldType == EWorldType::Game) || (WorldType == EWorldType::PIE);
+}
+
+void UDanzmannGameplayMessagesAIRouter::HandleGameplayMessage(const int32 BindingIndex, const FGameplayTag Channel, const FConstStructView GameplayMessage)
+{
+	if (!Bindings.IsValidIndex(BindingIndex))
+	{
+		return;
+	}
+
+	const bool bWasRouting = bIsRouting;
+	{
+		TGuardValue<bool> RoutingGuard(bIsRouting, true);
+
+		const FBinding& Binding = Bindings[BindingIndex];
+
+		// Find target through the property resolved when binding was created, Gameplay Messages of other types can only be matched by parent types
+		const AActor* Target = nullptr;
+		const UScriptStruct* TargetPropertyOwnerStructType = Binding.TargetPropertyOwnerStructType.Get();
+		if ((Binding.TargetProperty != nullptr) && (TargetPropertyOwnerStructType != nullptr) && (GameplayMessage.GetScriptStruct() != nullptr) && GameplayMessage.GetScriptStruct()->IsChildOf(TargetPropertyOwnerStructType))
+		{
+			Target = Cast<AActor>(Binding.TargetProperty->GetObjectPropertyValue_InContainer(GameplayMessage.GetMemory()));
+			if (const AController* Controller = Cast<AController>(Target))
+			{
+				Target = Controller->GetPawn() != nullptr ? Controller->GetPawn() : Target;
+			}
+		}
+
+		auto InvokeSubscriptions = [Channel, GameplayMessage](const TArray<FSubscription, TInlineAllocator<1>>& Subscriptions)
+		{
+			// Subscriptions can't be added while routing, so the array stays put
+			for (const FSubscription& Subscription : Subscriptions)
+			{
+				if (Subscription.Id != 0)
+				{
+					Subscription.Callback(Channel, GameplayMessage);
+				}
+			}
+		};
+
+		if (Target != nullptr)
+		{
+			if (const TArray<FSubscription, TInlineAllocator<1>>* Subscriptions = Binding.SubscriptionsByTarget.Find(FObjectKey(Target)))
+			{
+				InvokeSubscriptions(*Subscriptions);
+			}
+		}
+		else
+		{
+			for (const TPair<FObjectKey, TArray<FSubscription, TInlineAllocator<1>>>& Pair : Binding.SubscriptionsByTarget)
+			{
+				InvokeSubscriptions(Pair.Value);
+			}
+		}
+	}
+
+	if (!bWasRouting)
+	{
+		for (const int32 BindingToCleanUp : BindingsToCleanUp)
+		{
+			CleanUpBinding(BindingToCleanUp);
+		}
+		BindingsToCleanUp.Reset();
+	}
+}
+
+void UDanzmannGameplayMessagesAIRouter::CleanUpBinding(const int32 BindingIndex)
+{
+	if (!Bindings.IsValidIndex(BindingIndex))
+	{
+		return;
+	}
+
+	FBinding& Binding = Bindings[BindingIndex];
+	for (auto It = Binding.SubscriptionsByTarget.CreateIterator(); It; ++It)
+	{
+		It->Value.RemoveAllSwap([](const FSubscription& Subscription) { return Subscription.Id == 0; });
+		if (It->Value.IsEmpty())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Last subscription gone, binding listener is unregistered along with it
+	if (Binding.NumSubscriptions == 0)
+	{
+		BindingIndices.Remove(Binding.Key);
+		Bindings.RemoveAt(BindingIndex);
+	}
+}
@@ -0,0 +1,51 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannStateTreeGameplayMessageTask.h"
+#include "GameFramework/Actor.h"
+#include "StateTreeExecutionContext.h"
+
+FDanzmannStateTreeGameplayMessageTask::FDanzmannStateTreeGameplayMessageTask()
+{
+	// Only reacts to Gameplay Messages
+	bShouldCallTick = false;
+	bShouldStateChangeOnReselect = false;
+}
+
+EStateTreeRunStatus FDanzmannStateTreeGameplayMessageTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	UDanzmannGameplayMessagesAIRouter* Router = UDanzmannGameplayMessagesAIRouter::Get(Context.GetOwner());
+	if ((Router == nullptr) || (InstanceData.Actor == nullptr))
+	{
+		return EStateTreeRunStatus::Running;
+	}
+
+	// Shared by every instance of this StateTree listening to the same channel
+	FDanzmannGameplayMessagesAIBindingKey BindingKey;
+	BindingKey.Channel = Channel;
+	BindingKey.ChannelMatchCriteria = ChannelMatchCriteria;
+	BindingKey.Asset = Context.GetStateTree();
+	BindingKey.GameplayMessageStructType = GameplayMessageStructType;
+	BindingKey.TargetPropertyName = TargetPropertyName;
+
+	// Events are queued by StateTree and processed on its next update
+	InstanceData.SubscriptionHandle = Router->Subscribe(BindingKey, InstanceData.Actor,
+		[WeakContext = Context.MakeWeakExecutionContext(), SentEventTag = EventTag](const FGameplayTag ReceivedChannel, const FConstStructView GameplayMessage)
+		{
+			WeakContext.SendEvent(SentEventTag.IsValid() ? SentEventTag : ReceivedChannel, GameplayMessage);
+		}
+	);
+
+	return EStateTreeRunStatus::Running;
+}
+
+void FDanzmannStateTreeGameplayMessageTask::ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	if (UDanzmannGameplayMessagesAIRouter* Router = UDanzmannGameplayMessagesAIRouter::Get(Context.GetOwner()))
+	{
+		Router->Unsubscribe(InstanceData.SubscriptionHandle);
+	}
+}
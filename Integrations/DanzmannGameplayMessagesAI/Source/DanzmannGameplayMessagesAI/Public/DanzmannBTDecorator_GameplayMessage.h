@@ -0,0 +1,100 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "BehaviorTree/BTDecorator.h"
+#include "DanzmannGameplayMessagesAIRouter.h"
+
+#include "DanzmannBTDecorator_GameplayMessage.generated.h"
+
+/**
+ * Decorator passing for a while after a Gameplay Message targeting the AI (or every AI, if it has no target) is received on a channel.
+ * Receiving one requests a flow abort according to the abort mode, as does the end of the retention time, so branches can be driven by Gameplay Messages.
+ * Every behavior tree instance of the same asset listening to the same channel shares a single listener, see UDanzmannGameplayMessagesAIRouter.
+ */
+UCLASS(DisplayName = "Gameplay Message Received")
+class DANZMANNGAMEPLAYMESSAGESAI_API UDanzmannBTDecorator_GameplayMessage : public UBTDecorator
+{
+	GENERATED_BODY()
+
+	public:
+		UDanzmannBTDecorator_GameplayMessage();
+
+		/**
+		 * @see more info in UBTNode.
+		 */
+		virtual uint16 GetInstanceMemorySize() const override;
+
+		/**
+		 * @see more info in UBTNode.
+		 */
+		virtual void InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
+
+		/**
+		 * @see more info in UBTNode.
+		 */
+		virtual void CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const override;
+
+		/**
+		 * @see more info in UBTNode.
+		 */
+		virtual FString GetStaticDescription() const override;
+
+	protected:
+		/**
+		 * @see more info in UBTDecorator.
+		 */
+		virtual bool CalculateRawConditionValue(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) const override;
+
+		/**
+		 * @see more info in UBTAuxiliaryNode.
+		 */
+		virtual void OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+		/**
+		 * @see more info in UBTAuxiliaryNode.
+		 */
+		virtual void OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+		/**
+		 * @see more info in UBTAuxiliaryNode.
+		 */
+		virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+
+		/**
+		 * Channel Gameplay Messages are received from.
+		 */
+		UPROPERTY(EditAnywhere, Category = "Gameplay Messages")
+		FGameplayTag Channel;
+
+		/**
+		 * Criteria to match Channel.
+		 */
+		UPROPERTY(EditAnywhere, Category = "Gameplay Messages")
+		EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria = EDanzmannGameplayMessagesMatchCriteria::ExactMatch;
+
+		/**
+		 * Gameplay Message struct type expected, Gameplay Messages of any type are received if not set.
+		 */
+		UPROPERTY(EditAnywhere, Category = "Gameplay Messages")
+		TObjectPtr<const UScriptStruct> GameplayMessageStructType = nullptr;
+
+		/**
+		 * Name of the Gameplay Message actor property holding its target. Gameplay Messages without one are received by every behavior tree instance.
+		 */
+		UPROPERTY(EditAnywhere, Category = "Gameplay Messages")
+		FName TargetPropertyName = TEXT("Target");
+
+		/**
+		 * How long decorator passes after a Gameplay Message is received, in seconds.
+		 */
+		UPROPERTY(EditAnywhere, Category = "Gameplay Messages", Meta = (ClampMin = "0.0", UIMin = "0.0", ForceUnits = "s"))
+		float RetentionTime = 1.0f;
+
+	private:
+		/**
+		 * Handle a Gameplay Message received for a behavior tree instance.
+		 * @param OwnerComp Behavior tree component of instance.
+		 */
+		void HandleGameplayMessage(UBehaviorTreeComponent& OwnerComp);
+};
@@ -0,0 +1,205 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "DanzmannGameplayMessagesListener.h"
+#include "DanzmannScopedGameplayMessageListener.h"
+#include "GameplayTagContainer.h"
+#include "StructUtils/StructView.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "DanzmannGameplayMessagesAIRouter.generated.h"
+
+class AActor;
+
+/**
+ * Binding shared by every AI instance of the same asset listening to the same channel.
+ */
+struct FDanzmannGameplayMessagesAIBindingKey
+{
+	/**
+	 * Channel listened to.
+	 */
+	FGameplayTag Channel;
+
+	/**
+	 * Criteria to match channel.
+	 */
+	EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria = EDanzmannGameplayMessagesMatchCriteria::ExactMatch;
+
+	/**
+	 * Asset of the AI instances (e.g., StateTree, behavior tree).
+	 */
+	FObjectKey Asset;
+
+	/**
+	 * Gameplay Message struct type expected, Gameplay Messages of any type are received if not set.
+	 */
+	FObjectKey GameplayMessageStructType;
+
+	/**
+	 * Name of the Gameplay Message property holding the actor it's about, Gameplay Messages are delivered to every instance if none.
+	 */
+	FName TargetPropertyName;
+
+	bool operator==(const FDanzmannGameplayMessagesAIBindingKey& Other) const
+	{
+		return (Channel == Other.Channel) && (ChannelMatchCriteria == Other.ChannelMatchCriteria) && (Asset == Other.Asset) && (GameplayMessageStructType == Other.GameplayMessageStructType) && (TargetPropertyName == Other.TargetPropertyName);
+	}
+
+	friend uint32 GetTypeHash(const FDanzmannGameplayMessagesAIBindingKey& Key)
+	{
+		return HashCombineFast(HashCombineFast(GetTypeHash(Key.Channel), GetTypeHash(Key.Asset)), HashCombineFast(GetTypeHash(Key.GameplayMessageStructType), GetTypeHash(Key.TargetPropertyName)));
+	}
+};
+
+/**
+ * Handle of an AI instance subscribed to a binding.
+ */
+struct FDanzmannGameplayMessagesAISubscriptionHandle
+{
+	/**
+	 * Index of binding.
+	 */
+	int32 BindingIndex = INDEX_NONE;
+
+	/**
+	 * ID of subscription, unique within router.
+	 */
+	uint32 SubscriptionId = 0;
+
+	/**
+	 * Target actor subscription is keyed by.
+	 */
+	FObjectKey Target;
+
+	bool IsValid() const
+	{
+		return SubscriptionId != 0;
+	}
+};
+
+/**
+ * Router of Gameplay Messages to AI instances (e.g., StateTree, behavior tree), used by the integration nodes of this module.
+ * Instances running the same asset and listening to the same channel share a single listener registration, and each Gameplay Message
+ * is routed to the instances of the actor it's about through a target-keyed index. A thousand AI instances listening to the same channel
+ * then cost a single dispatch entry and a map lookup per Gameplay Message, instead of a thousand listeners.
+ * Targets are found in Gameplay Messages through an object property resolved once per binding: controllers are routed to their pawn,
+ * while Gameplay Messages without a target (or without a target property) are delivered to every instance of the binding.
+ */
+UCLASS()
+class DANZMANNGAMEPLAYMESSAGESAI_API UDanzmannGameplayMessagesAIRouter : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+	public:
+		/**
+		 * @see more info in USubsystem.
+		 */
+		virtual void Deinitialize() override;
+
+		/**
+		 * Get AI router of the world of the specified object.
+		 * @return Router of the world, nullptr if world doesn't have one.
+		 */
+		static UDanzmannGameplayMessagesAIRouter* Get(const UObject* WorldContextObject);
+
+		/**
+		 * Subscribe an AI instance to a binding, registering binding listener if it's the first subscription.
+		 * @param BindingKey Binding to subscribe to.
+		 * @param Target Actor of AI instance (usually its pawn), Gameplay Messages about it are delivered to Callback.
+		 * @param Callback Function to call when a Gameplay Message is received. Meant to queue work (e.g., send an event, request an execution),
+		 *                 it can unsubscribe but must not subscribe.
+		 * @return Handle that can be used to unsubscribe, invalid if subscription failed.
+		 */
+		FDanzmannGameplayMessagesAISubscriptionHandle Subscribe(const FDanzmannGameplayMessagesAIBindingKey& BindingKey, const AActor* Target, TFunction<void(const FGameplayTag, const FConstStructView)>&& Callback);
+
+		/**
+		 * Unsubscribe an AI instance, unregistering binding listener if it was the last subscription. Handle is reset.
+		 * @param Handle The handle returned by Subscribe().
+		 */
+		void Unsubscribe(FDanzmannGameplayMessagesAISubscriptionHandle& Handle);
+
+	protected:
+		/**
+		 * @see more info in UWorldSubsystem.
+		 */
+		virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	private:
+		struct FSubscription
+		{
+			uint32 Id = 0;
+			TFunction<void(const FGameplayTag, const FConstStructView)> Callback;
+		};
+
+		struct FBinding
+		{
+			FDanzmannGameplayMessagesAIBindingKey Key;
+
+			/**
+			 * Single listener of binding.
+			 */
+			FDanzmannScopedGameplayMessageListener Listener;
+
+			/**
+			 * Target property, resolved once when binding is created.
+			 */
+			const FObjectPropertyBase* TargetProperty = nullptr;
+
+			/**
+			 * Struct type owning target property.
+			 */
+			TWeakObjectPtr<const UScriptStruct> TargetPropertyOwnerStructType;
+
+			/**
+			 * Subscriptions indexed by target.
+			 */
+			TMap<FObjectKey, TArray<FSubscription, TInlineAllocator<1>>> SubscriptionsByTarget;
+
+			/**
+			 * Number of subscriptions, not counting removed ones waiting to be purged.
+			 */
+			int32 NumSubscriptions = 0;
+		};
+
+		/**
+		 * Route a Gameplay Message received by a binding to the subscriptions of its target.
+		 * @param BindingIndex Index of binding.
+		 * @param Channel Channel Gameplay Message was broadcast on.
+		 * @param GameplayMessage Gameplay Message.
+		 */
+		void HandleGameplayMessage(const int32 BindingIndex, const FGameplayTag Channel, const FConstStructView GameplayMessage);
+
+		/**
+		 * Purge subscriptions removed while routing, then remove binding if it has no subscription left.
+		 * @param BindingIndex Index of binding.
+		 */
+		void CleanUpBinding(const int32 BindingIndex);
+
+		/**
+		 * Bindings, indices are stable.
+		 */
+		TSparseArray<FBinding> Bindings;
+
+		/**
+		 * Index of each binding.
+		 */
+		TMap<FDanzmannGameplayMessagesAIBindingKey, int32> BindingIndices;
+
+		/**
+		 * Bindings whose subscriptions were removed while routing, their ID is reset until they're purged.
+		 */
+		TArray<int32> BindingsToCleanUp;
+
+		/**
+		 * Last subscription ID given.
+		 */
+		uint32 LastSubscriptionId = 0;
+
+		/**
+		 * Whether Gameplay Messages are being routed, subscriptions can't be added meanwhile and removed ones are only purged afterwards.
+		 */
+		bool bIsRouting = false;
+};
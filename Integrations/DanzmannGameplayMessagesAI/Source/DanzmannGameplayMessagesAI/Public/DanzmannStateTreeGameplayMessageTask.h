@@ -0,0 +1,88 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "DanzmannGameplayMessagesAIRouter.h"
+#include "StateTreeTaskBase.h"
+
+#include "DanzmannStateTreeGameplayMessageTask.generated.h"
+
+USTRUCT()
+struct DANZMANNGAMEPLAYMESSAGESAI_API FDanzmannStateTreeGameplayMessageTaskInstanceData
+{
+	GENERATED_BODY()
+
+	/**
+	 * Actor of StateTree instance, Gameplay Messages targeting it (or its controller) are received.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Context")
+	TObjectPtr<AActor> Actor = nullptr;
+
+	/**
+	 * Subscription to AI router, valid while task is active.
+	 */
+	FDanzmannGameplayMessagesAISubscriptionHandle SubscriptionHandle;
+};
+
+/**
+ * Send Gameplay Messages received on a channel as StateTree events, so transitions can be triggered by them (with Gameplay Message as event payload).
+ * Every StateTree instance of the same asset listening to the same channel shares a single listener, see UDanzmannGameplayMessagesAIRouter.
+ * Usually added as a global task, so Gameplay Messages are received for as long as StateTree runs.
+ */
+USTRUCT(Meta = (DisplayName = "Receive Gameplay Messages", Category = "Dancing Man|Gameplay Messages"))
+struct DANZMANNGAMEPLAYMESSAGESAI_API FDanzmannStateTreeGameplayMessageTask : public FStateTreeTaskCommonBase
+{
+	GENERATED_BODY()
+
+	using FInstanceDataType = FDanzmannStateTreeGameplayMessageTaskInstanceData;
+
+	FDanzmannStateTreeGameplayMessageTask();
+
+	/**
+	 * @see more info in FStateTreeNodeBase.
+	 */
+	virtual const UStruct* GetInstanceDataType() const override
+	{
+		return FInstanceDataType::StaticStruct();
+	}
+
+	/**
+	 * @see more info in FStateTreeTaskBase.
+	 */
+	virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+
+	/**
+	 * @see more info in FStateTreeTaskBase.
+	 */
+	virtual void ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+
+	/**
+	 * Channel Gameplay Messages are received from.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Parameter")
+	FGameplayTag Channel;
+
+	/**
+	 * Criteria to match Channel.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Parameter")
+	EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria = EDanzmannGameplayMessagesMatchCriteria::ExactMatch;
+
+	/**
+	 * Gameplay Message struct type expected, Gameplay Messages of any type are received if not set.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Parameter")
+	TObjectPtr<const UScriptStruct> GameplayMessageStructType = nullptr;
+
+	/**
+	 * Name of the Gameplay Message actor property holding its target. Gameplay Messages without one are sent to every StateTree instance.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Parameter")
+	FName TargetPropertyName = TEXT("Target");
+
+	/**
+	 * Tag of the events sent, channel Gameplay Message was broadcast on if not set.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Parameter")
+	FGameplayTag EventTag;
+};
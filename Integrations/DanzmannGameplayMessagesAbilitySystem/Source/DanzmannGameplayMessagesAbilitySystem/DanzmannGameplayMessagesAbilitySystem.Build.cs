@@ -0,0 +1,30 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class DanzmannGameplayMessagesAbilitySystem : ModuleRules
+{
+	public DanzmannGameplayMessagesAbilitySystem(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"DanzmannGameplayMessages",
+				"DeveloperSettings",
+				"Engine",
+				"GameplayAbilities",
+				"GameplayTags"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject"
+			}
+		);
+	}
+}
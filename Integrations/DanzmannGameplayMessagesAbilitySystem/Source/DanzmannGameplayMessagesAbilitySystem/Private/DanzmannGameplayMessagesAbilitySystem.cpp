@@ -0,0 +1,17 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesAbilitySystem.h"
+
+#define LOCTEXT_NAMESPACE "FDanzmannGameplayMessagesAbilitySystemModule"
+
+void FDanzmannGameplayMessagesAbilitySystemModule::StartupModule()
+{
+}
+
+void FDanzmannGameplayMessagesAbilitySystemModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+	
+IMPLEMENT_MODULE(FDanzmannGameplayMessagesAbilitySystemModule, DanzmannGameplayMessagesAbilitySystem)
@@ -0,0 +1,128 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesAbilitySystemBridge.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Abilities/GameplayAbilityTypes.h"
+#include "DanzmannGameplayMessagesAbilitySystemSettings.h"
+#include "DanzmannGameplayMessagesGameInstanceSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "StructUtils/StructView.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDanzmannGameplayMessagesAbilitySystem, Log, All);
+
+void UDanzmannGameplayMessagesAbilitySystemBridge::PostInitialize()
+{
+	Super::PostInitialize();
+
+	const UDanzmannGameplayMessagesAbilitySystemSettings* Settings = GetDefault<UDanzmannGameplayMessagesAbilitySystemSettings>();
+	BridgedEventTags = Settings->BridgedEventTags;
+
+	// Routers are created when worlds are initialized, so the one of this world is around by now
+	const UWorld* World = GetWorld();
+	if (!Settings->bForwardGameplayMessages || BridgedEventTags.IsEmpty() || !UDanzmannGameplayMessagesGameInstanceSubsystem::HasInstance(World))
+	{
+		return;
+	}
+
+	// Gameplay Ability System matches child event tags too, so do bridged channels
+	UDanzmannGameplayMessagesGameInstanceSubsystem* GameplayMessagesSubsystem = UDanzmannGameplayMessagesGameInstanceSubsystem::Get(World);
+	for (const FGameplayTag& EventTag : BridgedEventTags)
+	{
+		Listeners.Emplace(GameplayMessagesSubsystem, GameplayMessagesSubsystem->RegisterListener(EventTag, this, &ThisClass::HandleGameplayMessage, EDanzmannGameplayMessagesMatchCriteria::PartialMatch));
+	}
+}
+
+void UDanzmannGameplayMessagesAbilitySystemBridge::Deinitialize()
+{
+	Listeners.Reset();
+
+	for (const TPair<TObjectKey<UAbilitySystemComponent>, TPair<TWeakObjectPtr<UAbilitySystemComponent>, FDelegateHandle>>& Pair : BridgedAbilitySystemComponents)
+	{
+		if (UAbilitySystemComponent* AbilitySystemComponent = Pair.Value.Key.Get())
+		{
+			AbilitySystemComponent->RemoveGameplayEventTagContainerDelegate(BridgedEventTags, Pair.Value.Value);
+		}
+	}
+	BridgedAbilitySystemComponents.Reset();
+
+	Super::Deinitialize();
+}
+
+UDanzmannGameplayMessagesAbilitySystemBridge* UDanzmannGameplayMessagesAbilitySystemBridge::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return IsValid(World) ? World->GetSubsystem<UDanzmannGameplayMessagesAbilitySystemBridge>() : nullptr;
+}
+
+void UDanzmannGameplayMessagesAbilitySystemBridge::BridgeAbilitySystemComponent(UAbilitySystemComponent* AbilitySystemComponent)
+{
+	if (!IsValid(AbilitySystemComponent))
+	{
+		UE_LOG(LogDanzmannGameplayMessagesAbilitySystem, Warning, TEXT("[%hs] Trying to bridge an invalid ability system component."), __FUNCTION__);
+		return;
+	}
+
+	if (!GetDefault<UDanzmannGameplayMessagesAbilitySystemSettings>()->bForwardGameplayEvents || BridgedEventTags.IsEmpty() || BridgedAbilitySystemComponents.Contains(AbilitySystemComponent))
+	{
+		return;
+	}
+
+	// A single delegate covers every bridged event tag
+	const FDelegateHandle DelegateHandle = AbilitySystemComponent->AddGameplayEventTagContainerDelegate(BridgedEventTags, FGameplayEventTagMulticastDelegate::FDelegate::CreateUObject(this, &ThisClass::HandleGameplayEvent));
+	BridgedAbilitySystemComponents.Add(AbilitySystemComponent, { AbilitySystemComponent, DelegateHandle });
+}
+
+void UDanzmannGameplayMessagesAbilitySystemBridge::UnbridgeAbilitySystemComponent(UAbilitySystemComponent* AbilitySystemComponent)
+{
+	TPair<TWeakObjectPtr<UAbilitySystemComponent>, FDelegateHandle> Bridged;
+	if ((AbilitySystemComponent != nullptr) && BridgedAbilitySystemComponents.RemoveAndCopyValue(AbilitySystemComponent, Bridged))
+	{
+		AbilitySystemComponent->RemoveGameplayEventTagContainerDelegate(BridgedEventTags, Bridged.Value);
+	}
+}
+
+bool UDanzmannGameplayMessagesAbilitySystemBridge::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return (WorldType == EWorldType::Game) || (WorldType == EWorldType::PIE);
+}
+
+void UDanzmannGameplayMessagesAbilitySystemBridge::HandleGameplayEvent(FGameplayTag EventTag, const FGameplayEventData* Payload)
+{
+	// Event forwarded by this bridge coming back, or nothing to forward
+	if ((Payload == nullptr) || (Payload == ForwardedPayload))
+	{
+		return;
+	}
+
+	const UWorld* World = GetWorld();
+	if (!UDanzmannGameplayMessagesGameInstanceSubsystem::HasInstance(World))
+	{
+		return;
+	}
+
+	// View of the event data handled by ability system component, listeners are dispatched without copying it
+	TGuardValue<const FGameplayEventData*> ForwardedPayloadGuard(ForwardedPayload, Payload);
+	UDanzmannGameplayMessagesGameInstanceSubsystem::Get(World)->BroadcastGameplayMessage(EventTag, FConstStructView::Make(*Payload));
+}
+
+void UDanzmannGameplayMessagesAbilitySystemBridge::HandleGameplayMessage(const FGameplayTag Channel, const FGameplayEventData& GameplayMessage)
+{
+	// Gameplay Message broadcast by this bridge coming back
+	if (&GameplayMessage == ForwardedPayload)
+	{
+		return;
+	}
+
+	UAbilitySystemComponent* AbilitySystemComponent = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GameplayMessage.Target.Get());
+	if (AbilitySystemComponent == nullptr)
+	{
+		UE_LOG(LogDanzmannGameplayMessagesAbilitySystem, Verbose, TEXT("[%hs] Gameplay Message on channel %s has no target with an ability system component, it's not sent as gameplay event."), __FUNCTION__, *Channel.ToString());
+		return;
+	}
+
+	// Gameplay Message memory is handed to ability system component as is
+	TGuardValue<const FGameplayEventData*> ForwardedPayloadGuard(ForwardedPayload, &GameplayMessage);
+	AbilitySystemComponent->HandleGameplayEvent(Channel, &GameplayMessage);
+}
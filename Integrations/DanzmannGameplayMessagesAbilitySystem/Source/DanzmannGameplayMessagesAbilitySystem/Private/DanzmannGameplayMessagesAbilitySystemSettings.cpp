@@ -0,0 +1,9 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesAbilitySystemSettings.h"
+
+UDanzmannGameplayMessagesAbilitySystemSettings::UDanzmannGameplayMessagesAbilitySystemSettings()
+{
+	CategoryName = TEXT("Plugins");
+	SectionName = TEXT("DanzmannGameplayMessagesAbilitySystem");
+}
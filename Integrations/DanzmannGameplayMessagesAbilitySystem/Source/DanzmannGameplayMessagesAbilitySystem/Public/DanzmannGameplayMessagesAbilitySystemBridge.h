@@ -0,0 +1,101 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "DanzmannScopedGameplayMessageListener.h"
+#include "GameplayTagContainer.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "DanzmannGameplayMessagesAbilitySystemBridge.generated.h"
+
+class UAbilitySystemComponent;
+struct FGameplayEventData;
+
+/**
+ * Bridge between Gameplay Ability System gameplay events and Gameplay Messages, so neither side needs hand-written listeners forwarding to the other.
+ * Each bridged ability system component is registered once to the event tags found in settings, and every forwarded event is a single dispatch
+ * with a view of the original FGameplayEventData (no copy), using its event tag as channel:
+ *  - Gameplay events handled by bridged ability system components are broadcast as Gameplay Messages;
+ *  - Gameplay Messages of FGameplayEventData type broadcast on bridged channels are sent as gameplay events to the ability system component of their target.
+ * Events forwarded by the bridge are marked as such while they're dispatched, so they're never forwarded back to where they came from.
+ * @see UDanzmannGameplayMessagesAbilitySystemSettings.
+ */
+UCLASS()
+class DANZMANNGAMEPLAYMESSAGESABILITYSYSTEM_API UDanzmannGameplayMessagesAbilitySystemBridge : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+	public:
+		/**
+		 * @see more info in UWorldSubsystem.
+		 */
+		virtual void PostInitialize() override;
+
+		/**
+		 * @see more info in USubsystem.
+		 */
+		virtual void Deinitialize() override;
+
+		/**
+		 * Get Gameplay Ability System bridge of the world of the specified object.
+		 * @return Bridge of the world, nullptr if world doesn't have one.
+		 */
+		static UDanzmannGameplayMessagesAbilitySystemBridge* Get(const UObject* WorldContextObject);
+
+		/**
+		 * Forward gameplay events handled by an ability system component as Gameplay Messages. Registers to its event delegates once, no matter how many event tags are bridged.
+		 * @param AbilitySystemComponent Ability system component to bridge. Nothing happens if it's bridged already.
+		 */
+		UFUNCTION(BlueprintCallable, Category = "Dancing Man|Gameplay Messages", DisplayName = "Bridge Ability System Component")
+		void BridgeAbilitySystemComponent(UAbilitySystemComponent* AbilitySystemComponent);
+
+		/**
+		 * Stop forwarding gameplay events handled by an ability system component.
+		 * @param AbilitySystemComponent Ability system component previously bridged by BridgeAbilitySystemComponent().
+		 */
+		UFUNCTION(BlueprintCallable, Category = "Dancing Man|Gameplay Messages", DisplayName = "Unbridge Ability System Component")
+		void UnbridgeAbilitySystemComponent(UAbilitySystemComponent* AbilitySystemComponent);
+
+	protected:
+		/**
+		 * @see more info in UWorldSubsystem.
+		 */
+		virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	private:
+		/**
+		 * Broadcast a gameplay event handled by a bridged ability system component as a Gameplay Message.
+		 * @param EventTag Gameplay event tag, used as channel.
+		 * @param Payload Gameplay event data.
+		 */
+		void HandleGameplayEvent(FGameplayTag EventTag, const FGameplayEventData* Payload);
+
+		/**
+		 * Send a Gameplay Message broadcast on a bridged channel as gameplay event to the ability system component of its target.
+		 * @param Channel Channel Gameplay Message was broadcast on, used as event tag.
+		 * @param GameplayMessage Gameplay event data.
+		 */
+		void HandleGameplayMessage(const FGameplayTag Channel, const FGameplayEventData& GameplayMessage);
+
+		/**
+		 * Origin marker: gameplay event data being forwarded by this bridge, if any. The same data coming back from the other side is the forwarded event itself,
+		 * which is ignored, while any other event raised in between (e.g., by a triggered ability) is forwarded as usual.
+		 */
+		const FGameplayEventData* ForwardedPayload = nullptr;
+
+		/**
+		 * Gameplay event tags bridged, copied from settings.
+		 */
+		FGameplayTagContainer BridgedEventTags;
+
+		/**
+		 * Bridged ability system components and handles of their event delegates.
+		 */
+		TMap<TObjectKey<UAbilitySystemComponent>, TPair<TWeakObjectPtr<UAbilitySystemComponent>, FDelegateHandle>> BridgedAbilitySystemComponents;
+
+		/**
+		 * Listeners of bridged channels, forwarding Gameplay Messages as gameplay events.
+		 */
+		TArray<FDanzmannScopedGameplayMessageListener> Listeners;
+};
@@ -0,0 +1,39 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/DeveloperSettings.h"
+#include "GameplayTagContainer.h"
+
+#include "DanzmannGameplayMessagesAbilitySystemSettings.generated.h"
+
+/**
+ * Gameplay Ability System bridge settings, found in Project Settings > Plugins > Dancing Man Gameplay Messages Ability System.
+ * @see UDanzmannGameplayMessagesAbilitySystemBridge.
+ */
+UCLASS(Config = Game, DefaultConfig, DisplayName = "Dancing Man Gameplay Messages Ability System")
+class DANZMANNGAMEPLAYMESSAGESABILITYSYSTEM_API UDanzmannGameplayMessagesAbilitySystemSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+	public:
+		UDanzmannGameplayMessagesAbilitySystemSettings();
+
+		/**
+		 * Gameplay event tags bridged between Gameplay Ability System and Gameplay Messages, along with their child tags. Each event tag is used as channel.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Bridge")
+		FGameplayTagContainer BridgedEventTags;
+
+		/**
+		 * Whether gameplay events handled by bridged ability system components are broadcast as Gameplay Messages (FGameplayEventData).
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Bridge")
+		bool bForwardGameplayEvents = true;
+
+		/**
+		 * Whether Gameplay Messages (FGameplayEventData) broadcast on bridged channels are sent as gameplay events to the ability system component of their target.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Bridge")
+		bool bForwardGameplayMessages = true;
+};
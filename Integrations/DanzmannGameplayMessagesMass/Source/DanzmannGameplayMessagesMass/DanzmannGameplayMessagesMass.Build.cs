@@ -0,0 +1,29 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class DanzmannGameplayMessagesMass : ModuleRules
+{
+	public DanzmannGameplayMessagesMass(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"DanzmannGameplayMessages",
+				"Engine",
+				"GameplayTags",
+				"MassEntity"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject"
+			}
+		);
+	}
+}
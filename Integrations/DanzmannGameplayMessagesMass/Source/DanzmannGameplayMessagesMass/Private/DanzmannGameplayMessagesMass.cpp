@@ -0,0 +1,17 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesMass.h"
+
+#define LOCTEXT_NAMESPACE "FDanzmannGameplayMessagesMassModule"
+
+void FDanzmannGameplayMessagesMassModule::StartupModule()
+{
+}
+
+void FDanzmannGameplayMessagesMassModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+	
+IMPLEMENT_MODULE(FDanzmannGameplayMessagesMassModule, DanzmannGameplayMessagesMass)
@@ -0,0 +1,108 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesMassProcessor.h"
+#include "Algo/StableSort.h"
+#include "DanzmannGameplayMessagesGameInstanceSubsystem.h"
+#include "DanzmannMassGameplayMessage.h"
+#include "Engine/World.h"
+#include "MassEntityUtils.h"
+#include "MassExecutionContext.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDanzmannGameplayMessagesMass, Log, All);
+
+UDanzmannGameplayMessagesMassProcessor::UDanzmannGameplayMessagesMassProcessor() : EntityQuery(*this)
+{
+	// Gameplay Messages are broadcast and buffered on game thread
+	bRequiresGameThreadExecution = true;
+}
+
+void UDanzmannGameplayMessagesMassProcessor::Initialize(UObject& Owner)
+{
+	Super::Initialize(Owner);
+
+	if (!Channel.IsValid() || (GameplayMessageStructType == nullptr) || !GameplayMessageStructType->IsChildOf(FDanzmannMassGameplayMessage::StaticStruct()))
+	{
+		UE_LOG(LogDanzmannGameplayMessagesMass, Error, TEXT("[%hs] %s needs a valid channel and a Gameplay Message struct type deriving from FDanzmannMassGameplayMessage."), __FUNCTION__, *GetNameSafe(GetClass()));
+		return;
+	}
+
+	const UWorld* World = Owner.GetWorld();
+	if (!UDanzmannGameplayMessagesGameInstanceSubsystem::HasInstance(World))
+	{
+		return;
+	}
+
+	// Each processor owns its buffer, so processors consuming the same channel don't steal each other's Gameplay Messages
+	Buffer = MakeShared<FDanzmannGameplayMessageBuffer>(GameplayMessageStructType);
+
+	UDanzmannGameplayMessagesGameInstanceSubsystem* Subsystem = UDanzmannGameplayMessagesGameInstanceSubsystem::Get(World);
+	Listener = FDanzmannScopedGameplayMessageListener(Subsystem, Subsystem->RegisterListener(Channel, Buffer.ToSharedRef(), ChannelMatchCriteria));
+}
+
+void UDanzmannGameplayMessagesMassProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	if (!Buffer.IsValid() || (Buffer->Num() == 0))
+	{
+		return;
+	}
+
+	// Group Gameplay Messages by entity, stable sort keeps broadcast order within each entity
+	const int32 NumGameplayMessages = Buffer->Num();
+	SortedIndices.Reset(NumGameplayMessages);
+	for (int32 Index = 0; Index < NumGameplayMessages; ++Index)
+	{
+		SortedIndices.Add(Index);
+	}
+
+	const FDanzmannGameplayMessageBuffer& ConstBuffer = *Buffer;
+	Algo::StableSortBy(SortedIndices, [&ConstBuffer](const int32 Index)
+	{
+		const FMassEntityHandle& Entity = ConstBuffer.Get<FDanzmannMassGameplayMessage>(Index).Entity;
+		return (static_cast<uint64>(static_cast<uint32>(Entity.Index)) << 32) | static_cast<uint32>(Entity.SerialNumber);
+	});
+
+	EntityRanges.Reset();
+	Entities.Reset();
+	for (int32 SortedIndex = 0; SortedIndex < NumGameplayMessages; ++SortedIndex)
+	{
+		const FMassEntityHandle Entity = ConstBuffer.Get<FDanzmannMassGameplayMessage>(SortedIndices[SortedIndex]).Entity;
+		FDanzmannMassGameplayMessageRange& Range = EntityRanges.FindOrAdd(Entity, { SortedIndex, 0 });
+		if (Range.Num++ == 0)
+		{
+			Entities.Add(Entity);
+		}
+	}
+
+	// Only chunks holding entities with Gameplay Messages are visited. Invalid entities (e.g., already destroyed) are left out of collections
+	EntityCollections.Reset();
+	UE::Mass::Utils::CreateEntityCollections(EntityManager, Entities, FMassArchetypeEntityCollection::NoDuplicates, EntityCollections);
+
+	// Hand over Gameplay Messages one chunk at a time
+	TArray<FDanzmannMassGameplayMessageRange> ChunkRanges;
+	for (const FMassArchetypeEntityCollection& EntityCollection : EntityCollections)
+	{
+		// Entities not matching the query don't get their Gameplay Messages consumed
+		if (!EntityQuery.DoesArchetypeMatchRequirements(EntityCollection.GetArchetype()))
+		{
+			continue;
+		}
+
+		EntityQuery.ForEachEntityChunk(EntityCollection, EntityManager, Context, [this, &ConstBuffer, &ChunkRanges](FMassExecutionContext& ChunkContext)
+		{
+			const int32 NumEntities = ChunkContext.GetNumEntities();
+			ChunkRanges.Reset(NumEntities);
+
+			for (int32 EntityIndex = 0; EntityIndex < NumEntities; ++EntityIndex)
+			{
+				ChunkRanges.Add(EntityRanges.FindChecked(ChunkContext.GetEntity(EntityIndex)));
+			}
+
+			ConsumeGameplayMessages(ChunkContext, FDanzmannMassGameplayMessageBatch(ConstBuffer, SortedIndices, ChunkRanges));
+		});
+	}
+
+	ensureMsgf(Buffer->Num() == NumGameplayMessages, TEXT("Dancing Man Gameplay Messages | %s broadcast to its own channel while consuming Gameplay Messages."), *GetNameSafe(GetClass()));
+
+	// Gameplay Messages for entities not matching the query (e.g., already destroyed) are dropped along with the rest
+	Buffer->Reset();
+}
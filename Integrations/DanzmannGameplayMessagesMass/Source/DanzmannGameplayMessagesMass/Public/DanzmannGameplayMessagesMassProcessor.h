@@ -0,0 +1,188 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "DanzmannGameplayMessageBuffer.h"
+#include "DanzmannScopedGameplayMessageListener.h"
+#include "GameplayTagContainer.h"
+#include "MassArchetypeTypes.h"
+#include "MassEntityQuery.h"
+#include "MassProcessor.h"
+
+#include "DanzmannGameplayMessagesMassProcessor.generated.h"
+
+/**
+ * Range of the Gameplay Messages of a single entity, within a batch.
+ */
+struct FDanzmannMassGameplayMessageRange
+{
+	/**
+	 * First Gameplay Message of entity.
+	 */
+	int32 First = 0;
+
+	/**
+	 * Number of Gameplay Messages of entity.
+	 */
+	int32 Num = 0;
+};
+
+/**
+ * Gameplay Messages of the entities of a single archetype chunk, indexed like the entities of the execution context.
+ * Gameplay Messages of each entity keep the order they were broadcast in.
+ */
+class FDanzmannMassGameplayMessageBatch
+{
+	public:
+		FDanzmannMassGameplayMessageBatch(const FDanzmannGameplayMessageBuffer& InBuffer, const TConstArrayView<int32> InSortedIndices, const TConstArrayView<FDanzmannMassGameplayMessageRange> InEntityRanges) :
+			Buffer(InBuffer),
+			SortedIndices(InSortedIndices),
+			EntityRanges(InEntityRanges)
+		{
+		}
+
+		/**
+		 * Get number of Gameplay Messages of an entity.
+		 * @param EntityIndex Entity index within chunk.
+		 * @return Number of Gameplay Messages.
+		 */
+		int32 Num(const int32 EntityIndex) const
+		{
+			return EntityRanges[EntityIndex].Num;
+		}
+
+		/**
+		 * Get a Gameplay Message of an entity.
+		 * @tparam TGameplayMessage Gameplay Message struct type of processor, or one of its parents.
+		 * @param EntityIndex Entity index within chunk.
+		 * @param GameplayMessageIndex Index among Gameplay Messages of entity.
+		 * @return Gameplay Message.
+		 */
+		template<typename TGameplayMessage>
+		const TGameplayMessage& Get(const int32 EntityIndex, const int32 GameplayMessageIndex) const
+		{
+			return Buffer.Get<TGameplayMessage>(GetBufferIndex(EntityIndex, GameplayMessageIndex));
+		}
+
+		/**
+		 * Get channel a Gameplay Message of an entity was broadcast on.
+		 * @param EntityIndex Entity index within chunk.
+		 * @param GameplayMessageIndex Index among Gameplay Messages of entity.
+		 * @return Channel.
+		 */
+		FGameplayTag GetChannel(const int32 EntityIndex, const int32 GameplayMessageIndex) const
+		{
+			return Buffer.GetChannel(GetBufferIndex(EntityIndex, GameplayMessageIndex));
+		}
+
+	private:
+		int32 GetBufferIndex(const int32 EntityIndex, const int32 GameplayMessageIndex) const
+		{
+			checkSlow(GameplayMessageIndex < EntityRanges[EntityIndex].Num);
+			return SortedIndices[EntityRanges[EntityIndex].First + GameplayMessageIndex];
+		}
+
+		const FDanzmannGameplayMessageBuffer& Buffer;
+		TConstArrayView<int32> SortedIndices;
+		TConstArrayView<FDanzmannMassGameplayMessageRange> EntityRanges;
+};
+
+/**
+ * Base of Mass processors consuming Gameplay Messages in bulk, instead of invoking a callback per Gameplay Message and entity.
+ * Gameplay Messages broadcast on Channel are copied back to back into a buffer owned by processor, then grouped by entity once per execution
+ * and handed over one archetype chunk at a time to ConsumeGameplayMessages(). Gameplay Message struct type must derive from FDanzmannMassGameplayMessage.
+ * Subclasses add their requirements to EntityQuery in ConfigureQueries(), as usual. Processor runs on game thread, where Gameplay Messages are broadcast.
+ * @note Usage example:
+ *       void UMyProjectCrowdDamageProcessor::ConsumeGameplayMessages(FMassExecutionContext& Context, const FDanzmannMassGameplayMessageBatch& Batch)
+ *       {
+ *           const TArrayView<FMyProjectHealthFragment> HealthFragments = Context.GetMutableFragmentView<FMyProjectHealthFragment>();
+ *           for (int32 EntityIndex = 0; EntityIndex < Context.GetNumEntities(); ++EntityIndex)
+ *           {
+ *               for (int32 Index = 0; Index < Batch.Num(EntityIndex); ++Index)
+ *               {
+ *                   HealthFragments[EntityIndex].Health -= Batch.Get<FMyProjectGameplayMessage_CrowdDamage>(EntityIndex, Index).Damage;
+ *               }
+ *           }
+ *       }
+ */
+UCLASS(Abstract)
+class DANZMANNGAMEPLAYMESSAGESMASS_API UDanzmannGameplayMessagesMassProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+	public:
+		UDanzmannGameplayMessagesMassProcessor();
+
+	protected:
+		/**
+		 * @see more info in UMassProcessor.
+		 */
+		virtual void Initialize(UObject& Owner) override;
+
+		/**
+		 * @see more info in UMassProcessor.
+		 */
+		virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+		/**
+		 * Consume Gameplay Messages of the entities of an archetype chunk. Context only holds the chunk entities having Gameplay Messages.
+		 * @note Gameplay Messages must not be broadcast to Channel from here, buffer is being read.
+		 * @param Context Execution context of the chunk entities having Gameplay Messages.
+		 * @param Batch Gameplay Messages of each context entity.
+		 */
+		virtual void ConsumeGameplayMessages(FMassExecutionContext& Context, const FDanzmannMassGameplayMessageBatch& Batch) PURE_VIRTUAL(UDanzmannGameplayMessagesMassProcessor::ConsumeGameplayMessages, );
+
+		/**
+		 * Channel Gameplay Messages are consumed from.
+		 */
+		UPROPERTY(EditDefaultsOnly, Category = "Gameplay Messages")
+		FGameplayTag Channel;
+
+		/**
+		 * Criteria to match Channel.
+		 */
+		UPROPERTY(EditDefaultsOnly, Category = "Gameplay Messages")
+		EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria = EDanzmannGameplayMessagesMatchCriteria::ExactMatch;
+
+		/**
+		 * Gameplay Message struct type consumed, must derive from FDanzmannMassGameplayMessage.
+		 */
+		UPROPERTY(EditDefaultsOnly, Category = "Gameplay Messages", Meta = (MetaStruct = "/Script/DanzmannGameplayMessagesMass.DanzmannMassGameplayMessage"))
+		TObjectPtr<const UScriptStruct> GameplayMessageStructType = nullptr;
+
+		/**
+		 * Query of the entities Gameplay Messages are consumed for.
+		 */
+		FMassEntityQuery EntityQuery;
+
+	private:
+		/**
+		 * Buffer Gameplay Messages are copied into until next execution.
+		 */
+		TSharedPtr<FDanzmannGameplayMessageBuffer> Buffer;
+
+		/**
+		 * Buffer listener, unregistered along with processor.
+		 */
+		FDanzmannScopedGameplayMessageListener Listener;
+
+		/**
+		 * Buffer indices sorted by entity, reused from one execution to the next.
+		 */
+		TArray<int32> SortedIndices;
+
+		/**
+		 * Range of Gameplay Messages of each entity, reused from one execution to the next.
+		 */
+		TMap<FMassEntityHandle, FDanzmannMassGameplayMessageRange> EntityRanges;
+
+		/**
+		 * Entities having Gameplay Messages, reused from one execution to the next.
+		 */
+		TArray<FMassEntityHandle> Entities;
+
+		/**
+		 * Entities having Gameplay Messages grouped by archetype, reused from one execution to the next.
+		 */
+		TArray<FMassArchetypeEntityCollection> EntityCollections;
+};
@@ -0,0 +1,23 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "MassEntityTypes.h"
+
+#include "DanzmannMassGameplayMessage.generated.h"
+
+/**
+ * Base of Gameplay Messages meant for Mass entities, consumed in bulk by UDanzmannGameplayMessagesMassProcessor.
+ * Derive Gameplay Message structs from it and broadcast them as usual, they're grouped by Entity when consumed.
+ */
+USTRUCT()
+struct DANZMANNGAMEPLAYMESSAGESMASS_API FDanzmannMassGameplayMessage
+{
+	GENERATED_BODY()
+
+	/**
+	 * Entity Gameplay Message is meant for.
+	 */
+	UPROPERTY()
+	FMassEntityHandle Entity;
+};
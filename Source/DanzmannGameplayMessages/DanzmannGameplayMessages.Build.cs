@@ -12,6 +12,7 @@ public class DanzmannGameplayMessages : ModuleRules
 			new string[]
 			{
 				"Core",
+				"DeveloperSettings",
 				"Engine",
 				"GameplayTags"
 			}
@@ -0,0 +1,51 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessageBuffer.h"
+#include "UObject/Class.h"
+
+FDanzmannGameplayMessageBuffer::FDanzmannGameplayMessageBuffer(const UScriptStruct* InGameplayMessageStructType) :
+	GameplayMessageStructType(InGameplayMessageStructType)
+{
+	check(InGameplayMessageStructType != nullptr);
+	checkf(InGameplayMessageStructType->GetMinAlignment() <= 16, TEXT("Gameplay Message struct type %s alignment is not supported by buffers."), *InGameplayMessageStructType->GetName());
+
+	Stride = Align(InGameplayMessageStructType->GetStructureSize(), InGameplayMessageStructType->GetMinAlignment());
+}
+
+FDanzmannGameplayMessageBuffer::~FDanzmannGameplayMessageBuffer()
+{
+	Reset();
+}
+
+void FDanzmannGameplayMessageBuffer::Add(const FGameplayTag Channel, const void* GameplayMessagePayload)
+{
+	const UScriptStruct* StructType = GameplayMessageStructType.Get();
+	if (StructType == nullptr)
+	{
+		return;
+	}
+
+	const int32 Offset = Memory.AddUninitialized(Stride);
+	uint8* GameplayMessage = Memory.GetData() + Offset;
+	StructType->InitializeStruct(GameplayMessage);
+	StructType->CopyScriptStruct(GameplayMessage, GameplayMessagePayload);
+
+	Channels.Add(Channel);
+	++NumGameplayMessages;
+}
+
+void FDanzmannGameplayMessageBuffer::Reset()
+{
+	// Struct type is needed to destroy Gameplay Messages, there's nothing left to do for them once it's gone
+	if (const UScriptStruct* StructType = GameplayMessageStructType.Get())
+	{
+		for (int32 Index = 0; Index < NumGameplayMessages; ++Index)
+		{
+			StructType->DestroyStruct(Memory.GetData() + (Index * Stride));
+		}
+	}
+
+	Memory.Reset();
+	Channels.Reset();
+	NumGameplayMessages = 0;
+}
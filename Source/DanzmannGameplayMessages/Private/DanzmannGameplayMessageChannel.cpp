@@ -0,0 +1,89 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessageChannel.h"
+#include "DanzmannLogGameplayMessages.h"
+
+namespace DanzmannGameplayMessages::Private
+{
+	/**
+	 * Get first declared channel. Plain pointer, so it's usable before any other static is initialized.
+	 * @return First declared channel.
+	 */
+	static FDanzmannGameplayMessageChannel*& GetFirstChannel()
+	{
+		static FDanzmannGameplayMessageChannel* FirstChannel = nullptr;
+		return FirstChannel;
+	}
+
+	/**
+	 * Get dense indices given so far, by channel tag name, so channels whose hashes collide still get indices of their own.
+	 * Only used once channels are resolved, never during static initialization.
+	 * @return Channel indices.
+	 */
+	static TMap<FName, int32>& GetChannelIndices()
+	{
+		static TMap<FName, int32> ChannelIndices;
+		return ChannelIndices;
+	}
+}
+
+FDanzmannGameplayMessageChannel::FDanzmannGameplayMessageChannel(const TCHAR* TagName, const uint32 Hash):
+	TagName(TagName), Hash(Hash)
+{
+	FDanzmannGameplayMessageChannel*& FirstChannel = DanzmannGameplayMessages::Private::GetFirstChannel();
+	NextChannel = FirstChannel;
+	FirstChannel = this;
+}
+
+FDanzmannGameplayMessageChannel::~FDanzmannGameplayMessageChannel()
+{
+	// Module declaring channel is being unloaded
+	for (FDanzmannGameplayMessageChannel** Channel = &DanzmannGameplayMessages::Private::GetFirstChannel(); *Channel != nullptr; Channel = &(*Channel)->NextChannel)
+	{
+		if (*Channel == this)
+		{
+			*Channel = NextChannel;
+			break;
+		}
+	}
+}
+
+int32 FDanzmannGameplayMessageChannel::GetNumIndices()
+{
+	return DanzmannGameplayMessages::Private::GetChannelIndices().Num();
+}
+
+void FDanzmannGameplayMessageChannel::ResolveAll()
+{
+	int32 NumChannels = 0;
+	for (const FDanzmannGameplayMessageChannel* Channel = DanzmannGameplayMessages::Private::GetFirstChannel(); Channel != nullptr; Channel = Channel->NextChannel)
+	{
+		// Channels already used before native Gameplay Tags were done being added may have missed their tag
+		Channel->Resolve_Internal();
+		++NumChannels;
+	}
+
+	UE_LOG(LogDanzmannGameplayMessages, Verbose, TEXT("[%hs] Resolved %d declared channels."), __FUNCTION__, NumChannels);
+}
+
+void FDanzmannGameplayMessageChannel::Resolve_Internal() const
+{
+	check(IsInGameThread());
+
+	// Every declaration of the same channel shares its index. Indices are keyed by tag name, channel caches are indexed by them
+	const FName ChannelName(TagName);
+	TMap<FName, int32>& ChannelIndices = DanzmannGameplayMessages::Private::GetChannelIndices();
+	const int32 NumIndices = ChannelIndices.Num();
+	Index = ChannelIndices.FindOrAdd(ChannelName, NumIndices);
+
+	Hierarchy.Reset();
+	for (FGameplayTag Tag = FGameplayTag::RequestGameplayTag(ChannelName, false); Tag.IsValid(); Tag = Tag.RequestDirectParent())
+	{
+		Hierarchy.Add(Tag);
+	}
+
+	if (Hierarchy.Num() == 0)
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Error, TEXT("[%hs] Gameplay Tag %s of declared channel doesn't exist."), __FUNCTION__, TagName);
+	}
+}
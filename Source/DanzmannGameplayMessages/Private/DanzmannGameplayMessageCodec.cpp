@@ -0,0 +1,81 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessageCodec.h"
+#include "DanzmannLogGameplayMessages.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/Class.h"
+
+bool FDanzmannGameplayMessageCodec::Encode(FArchive& Writer, const FGameplayTag Channel, const FConstStructView GameplayMessage)
+{
+	FObjectAndNameAsStringProxyArchive ProxyWriter(Writer, false);
+	return Encode(Writer, ProxyWriter, Channel, GameplayMessage);
+}
+
+bool FDanzmannGameplayMessageCodec::Encode(FArchive& Writer, FArchive& ContentWriter, const FGameplayTag Channel, const FConstStructView GameplayMessage)
+{
+	const UScriptStruct* StructType = GameplayMessage.GetScriptStruct();
+	if (!Channel.IsValid() || (StructType == nullptr) || (GameplayMessage.GetMemory() == nullptr))
+	{
+		return false;
+	}
+
+	FName ChannelName = Channel.GetTagName();
+	FString StructPath = StructType->GetPathName();
+	Writer << ChannelName << StructPath;
+
+	// Content size is patched once written, so decoders can skip it
+	const int64 SizeOffset = Writer.Tell();
+	int32 Size = 0;
+	Writer << Size;
+
+	StructType->SerializeItem(ContentWriter, const_cast<uint8*>(GameplayMessage.GetMemory()), nullptr);
+
+	const int64 EndOffset = Writer.Tell();
+	Size = static_cast<int32>(EndOffset - SizeOffset - sizeof(int32));
+	Writer.Seek(SizeOffset);
+	Writer << Size;
+	Writer.Seek(EndOffset);
+
+	return !Writer.IsError();
+}
+
+bool FDanzmannGameplayMessageCodec::Decode(FArchive& Reader, FGameplayTag& OutChannel, FInstancedStruct& OutGameplayMessage)
+{
+	FName ChannelName;
+	FString StructPath;
+	int32 Size = 0;
+	Reader << ChannelName << StructPath << Size;
+
+	if (Reader.IsError() || (Size < 0) || ((Reader.Tell() + Size) > Reader.TotalSize()))
+	{
+		Reader.SetError();
+		return false;
+	}
+
+	const int64 EndOffset = Reader.Tell() + Size;
+
+	TWeakObjectPtr<const UScriptStruct>& CachedStructType = StructTypes.FindOrAdd(StructPath);
+	if (!CachedStructType.IsValid())
+	{
+		CachedStructType = FindObject<UScriptStruct>(nullptr, *StructPath);
+	}
+
+	OutChannel = FGameplayTag::RequestGameplayTag(ChannelName, false);
+	const UScriptStruct* StructType = CachedStructType.Get();
+	if (!OutChannel.IsValid() || (StructType == nullptr))
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Verbose, TEXT("[%hs] Gameplay Message (%s, %s) can't be resolved, skipping it."), __FUNCTION__, *ChannelName.ToString(), *StructPath);
+		Reader.Seek(EndOffset);
+		return false;
+	}
+
+	OutGameplayMessage.InitializeAs(StructType);
+	FObjectAndNameAsStringProxyArchive ProxyReader(Reader, false);
+	StructType->SerializeItem(ProxyReader, OutGameplayMessage.GetMutableMemory(), nullptr);
+
+	// Whatever wasn't read is skipped, so the next Gameplay Message starts where expected
+	const bool bIsValid = !Reader.IsError() && (Reader.Tell() <= EndOffset);
+	Reader.Seek(EndOffset);
+
+	return bIsValid;
+}
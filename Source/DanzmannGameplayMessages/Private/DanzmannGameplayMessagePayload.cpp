@@ -0,0 +1,26 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagePayload.h"
+
+FDanzmannGameplayMessagePayloadHandle FDanzmannGameplayMessagePayload::Create(const UScriptStruct* GameplayMessageStructType, const void* GameplayMessagePayload, const FDanzmannNativeGameplayMessageType* NativeGameplayMessageType, FInstancedStruct* OwnedGameplayMessage)
+{
+	TSharedPtr<FDanzmannGameplayMessagePayload, ESPMode::ThreadSafe> Payload = MakeShared<FDanzmannGameplayMessagePayload, ESPMode::ThreadSafe>();
+
+	// Native Gameplay Messages are trivially copyable, so a raw copy is all they need. Take over the broadcaster's instanced struct if it handed it over, otherwise copy the payload
+	if (NativeGameplayMessageType != nullptr)
+	{
+		Payload->NativeGameplayMessage.SetNumUninitialized(NativeGameplayMessageType->Size);
+		FMemory::Memcpy(Payload->NativeGameplayMessage.GetData(), GameplayMessagePayload, NativeGameplayMessageType->Size);
+		Payload->NativeTypeId = NativeGameplayMessageType->Id;
+	}
+	else if ((OwnedGameplayMessage != nullptr) && OwnedGameplayMessage->IsValid())
+	{
+		Payload->GameplayMessage = MoveTemp(*OwnedGameplayMessage);
+	}
+	else
+	{
+		Payload->GameplayMessage.InitializeAs(GameplayMessageStructType, static_cast<const uint8*>(GameplayMessagePayload));
+	}
+
+	return Payload;
+}
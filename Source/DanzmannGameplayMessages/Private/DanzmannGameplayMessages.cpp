@@ -1,18 +1,38 @@
 // Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
 
 #include "DanzmannGameplayMessages.h"
+#include "DanzmannGameplayMessageChannel.h"
+#include "DanzmannGameplayMessagesFlightRecorder.h"
+#include "DanzmannGameplayMessagesRouterCache.h"
+#include "Engine/World.h"
+#include "GameplayTagsManager.h"
+#include "Misc/CoreDelegates.h"
 
 #define LOCTEXT_NAMESPACE "FDanzmannGameplayMessagesModule"
 
 void FDanzmannGameplayMessagesModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+
+	// Channels declared in native code are resolved once, as soon as every native Gameplay Tag exists
+	UGameplayTagsManager::CallOrRegister_OnDoneAddingNativeTagsDelegate(FSimpleMulticastDelegate::FDelegate::CreateStatic(&FDanzmannGameplayMessageChannel::ResolveAll));
+
+	// Routers cached by world must not outlive their world
+	RouterCacheWorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&DanzmannGameplayMessages::Private::HandleRouterCacheWorldCleanup);
+
+	// Last broadcasts are dumped whenever something goes wrong, so crash reports and logs show what led to it
+	FlightRecorderSystemErrorHandle = FCoreDelegates::OnHandleSystemError.AddStatic(&DanzmannGameplayMessages::Private::HandleFlightRecorderSystemError);
+	FlightRecorderSystemEnsureHandle = FCoreDelegates::OnHandleSystemEnsure.AddStatic(&DanzmannGameplayMessages::Private::HandleFlightRecorderSystemEnsure);
 }
 
 void FDanzmannGameplayMessagesModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	FWorldDelegates::OnWorldCleanup.Remove(RouterCacheWorldCleanupHandle);
+	FCoreDelegates::OnHandleSystemError.Remove(FlightRecorderSystemErrorHandle);
+	FCoreDelegates::OnHandleSystemEnsure.Remove(FlightRecorderSystemEnsureHandle);
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,97 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesChannelManifest.h"
+#include "DanzmannLogGameplayMessages.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace DanzmannGameplayMessages::Private
+{
+	/**
+	 * Channel manifest file identifier and version.
+	 */
+	static constexpr uint32 ChannelManifestMagic = 0x444D434D;
+	static constexpr int32 ChannelManifestVersion = 1;
+}
+
+bool FDanzmannGameplayMessagesChannelManifest::Save(const FString& Filename) const
+{
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+
+	uint32 Magic = DanzmannGameplayMessages::Private::ChannelManifestMagic;
+	int32 Version = DanzmannGameplayMessages::Private::ChannelManifestVersion;
+	int32 NumEntries = Entries.Num();
+	Writer << Magic << Version << NumEntries;
+
+	for (const FEntry& Entry : Entries)
+	{
+		FName Channel = Entry.Channel;
+		FString GameplayMessageStructPath = Entry.GameplayMessageStructPath;
+		int32 NumListeners = Entry.NumListeners;
+		int32 NumBroadcasters = Entry.NumBroadcasters;
+		Writer << Channel << GameplayMessageStructPath << NumListeners << NumBroadcasters;
+	}
+
+	if (!FFileHelper::SaveArrayToFile(Data, *Filename))
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Error, TEXT("[%hs] Failed to save channel manifest to %s."), __FUNCTION__, *Filename);
+		return false;
+	}
+
+	return true;
+}
+
+bool FDanzmannGameplayMessagesChannelManifest::Load(const FString& Filename)
+{
+	Entries.Reset();
+
+	// Single read, then everything is parsed from memory
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *Filename))
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Warning, TEXT("[%hs] Failed to load channel manifest from %s."), __FUNCTION__, *Filename);
+		return false;
+	}
+
+	FMemoryReader Reader(Data);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	int32 NumEntries = 0;
+	Reader << Magic << Version << NumEntries;
+
+	if ((Magic != DanzmannGameplayMessages::Private::ChannelManifestMagic) || (Version != DanzmannGameplayMessages::Private::ChannelManifestVersion) || (NumEntries < 0))
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Warning, TEXT("[%hs] %s is not a valid channel manifest."), __FUNCTION__, *Filename);
+		return false;
+	}
+
+	Entries.Reserve(NumEntries);
+	for (int32 Index = 0; (Index < NumEntries) && !Reader.IsError(); ++Index)
+	{
+		FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Reader << Entry.Channel << Entry.GameplayMessageStructPath << Entry.NumListeners << Entry.NumBroadcasters;
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Warning, TEXT("[%hs] Channel manifest %s is truncated."), __FUNCTION__, *Filename);
+		Entries.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+FString FDanzmannGameplayMessagesChannelManifest::GetDefaultPath()
+{
+	return FPaths::Combine(FPaths::ProjectContentDir(), GetDefaultDirectory(), TEXT("ChannelManifest.bin"));
+}
+
+FString FDanzmannGameplayMessagesChannelManifest::GetDefaultDirectory()
+{
+	return TEXT("DanzmannGameplayMessages");
+}
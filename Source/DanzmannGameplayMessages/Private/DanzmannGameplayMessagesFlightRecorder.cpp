@@ -0,0 +1,122 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesFlightRecorder.h"
+#include "DanzmannLogGameplayMessages.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UnrealType.h"
+
+namespace DanzmannGameplayMessages::Private
+{
+	FFlightRecorder GFlightRecorder;
+	bool GFlightRecorderEnabled = DANZMANN_GAMEPLAY_MESSAGES_FLIGHT_RECORDER != 0;
+
+	static FAutoConsoleVariableRef CVarFlightRecorderEnabled(
+		TEXT("DanzmannGameplayMessages.FlightRecorder.Enabled"),
+		GFlightRecorderEnabled,
+		TEXT("Whether the last broadcasts are recorded, to be dumped on crash or ensure.")
+	);
+
+	static FAutoConsoleCommand CmdDumpFlightRecorder(
+		TEXT("DanzmannGameplayMessages.FlightRecorder.Dump"),
+		TEXT("Log the last broadcasts recorded, from oldest to newest."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			DumpFlightRecorder(TEXT("console command"));
+		})
+	);
+
+	/**
+	 * Export the properties of a recorded Gameplay Message that can be read back from its captured bytes.
+	 * Only plain old data fully captured is exported, anything else (e.g., strings, arrays, objects) may point to memory long gone.
+	 * @param Record Recorded broadcast.
+	 * @param GameplayMessageStructType Struct type of recorded broadcast, still alive and up to date.
+	 * @return Exported properties, unreadable ones are marked with "?".
+	 */
+	static FString ExportRecordedGameplayMessage(const FFlightRecorderRecord& Record, const UScriptStruct* GameplayMessageStructType)
+	{
+		FString HumanReadableMessage;
+		for (TFieldIterator<FProperty> It(GameplayMessageStructType); It; ++It)
+		{
+			const FProperty* Property = *It;
+			if (!HumanReadableMessage.IsEmpty())
+			{
+				HumanReadableMessage += TEXT(", ");
+			}
+
+			HumanReadableMessage += Property->GetName();
+			HumanReadableMessage += TEXT("=");
+
+			TArray<const FStructProperty*> EncounteredStructProperties;
+			const bool bIsReadable = Property->HasAnyPropertyFlags(CPF_IsPlainOldData)
+				&& !Property->IsA<FObjectPropertyBase>()
+				&& !Property->ContainsObjectReference(EncounteredStructProperties)
+				&& (static_cast<uint32>(Property->GetOffset_ForInternal() + Property->GetSize()) <= Record.PayloadSize);
+
+			if (bIsReadable)
+			{
+				for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+				{
+					Property->ExportText_InContainer(ArrayIndex, HumanReadableMessage, Record.Payload, nullptr, nullptr, PPF_None);
+				}
+			}
+			else
+			{
+				HumanReadableMessage += TEXT("?");
+			}
+		}
+
+		return HumanReadableMessage;
+	}
+
+	void DumpFlightRecorder(const TCHAR* Reason)
+	{
+		const uint32 NumRecorded = GFlightRecorder.NumRecorded.load(std::memory_order_acquire);
+		const uint32 NumEntries = FMath::Min(NumRecorded, FlightRecorderCapacity);
+		UE_LOG(LogDanzmannGameplayMessages, Log, TEXT("[%hs] Last %u of %u Gameplay Messages broadcast (%s):"), __FUNCTION__, NumEntries, NumRecorded, Reason);
+
+		for (uint32 Index = NumRecorded - NumEntries; Index != NumRecorded; ++Index)
+		{
+			const FFlightRecorderEntry& Entry = GFlightRecorder.Entries[Index & (FlightRecorderCapacity - 1)];
+
+			// Record is copied out, then dropped if game thread started overwriting it meanwhile (e.g., dumping on ensure from another thread)
+			const uint32 ExpectedSequence = 2 * (Index + 1);
+			if (Entry.Sequence.load(std::memory_order_acquire) != ExpectedSequence)
+			{
+				continue;
+			}
+
+			const FFlightRecorderRecord Record = Entry.Record;
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (Entry.Sequence.load(std::memory_order_relaxed) != ExpectedSequence)
+			{
+				continue;
+			}
+
+			// Native Gameplay Messages have no reflection data to export, so their captured bytes are logged as is
+			FString HumanReadableMessage;
+			if (Record.NativeGameplayMessageType != nullptr)
+			{
+				HumanReadableMessage = FString::Printf(TEXT("native %s {%s}"), Record.NativeGameplayMessageType->Name, *BytesToHex(Record.Payload, Record.PayloadSize));
+			}
+			else if (!Record.GameplayMessageStructName.IsNone())
+			{
+				// Struct types garbage collected or reinstanced since can't tell how captured bytes are laid out, only their name is logged
+				const UScriptStruct* GameplayMessageStructType = Cast<UScriptStruct>(Record.GameplayMessageStructType.Get());
+				const bool bIsStructTypeValid = (GameplayMessageStructType != nullptr) && !GameplayMessageStructType->HasAnyFlags(RF_NewerVersionExists | RF_BeginDestroyed | RF_FinishDestroyed);
+				HumanReadableMessage = FString::Printf(TEXT("%s {%s}"), *Record.GameplayMessageStructName.ToString(), bIsStructTypeValid ? *ExportRecordedGameplayMessage(Record, GameplayMessageStructType) : TEXT("?"));
+			}
+
+			UE_LOG(LogDanzmannGameplayMessages, Log, TEXT("[%hs]   Frame %llu, %s, %s"), __FUNCTION__, Record.Frame, *Record.Channel.ToString(), *HumanReadableMessage);
+		}
+	}
+
+	void HandleFlightRecorderSystemError()
+	{
+		DumpFlightRecorder(TEXT("crash"));
+	}
+
+	void HandleFlightRecorderSystemEnsure()
+	{
+		DumpFlightRecorder(TEXT("ensure"));
+	}
+}
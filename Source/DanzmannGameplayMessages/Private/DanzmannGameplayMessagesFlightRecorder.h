@@ -0,0 +1,132 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "CoreGlobals.h"
+#include "CoreMinimal.h"
+#include "DanzmannNativeGameplayMessage.h"
+#include "GameplayTagContainer.h"
+#include "UObject/Class.h"
+#include "UObject/WeakObjectPtr.h"
+
+#include <atomic>
+
+/**
+ * Whether every broadcast is recorded by the flight recorder. Recording is cheap enough to be left on in every build configuration.
+ */
+#ifndef DANZMANN_GAMEPLAY_MESSAGES_FLIGHT_RECORDER
+	#define DANZMANN_GAMEPLAY_MESSAGES_FLIGHT_RECORDER 1
+#endif
+
+namespace DanzmannGameplayMessages::Private
+{
+	/**
+	 * Number of broadcasts kept by the flight recorder, must be a power of two.
+	 */
+	static constexpr uint32 FlightRecorderCapacity = 256;
+	static_assert(FMath::IsPowerOfTwo(FlightRecorderCapacity), "Flight recorder capacity must be a power of two.");
+
+	/**
+	 * Number of payload bytes kept per broadcast.
+	 */
+	static constexpr uint32 FlightRecorderPayloadSize = 64;
+
+	/**
+	 * Broadcast recorded by the flight recorder. Payload is a raw copy of its first bytes, only the plain old data in it can be read back.
+	 * Struct type is only referenced weakly, it may be garbage collected or reinstanced long before the flight recorder is dumped.
+	 */
+	struct FFlightRecorderRecord
+	{
+		FGameplayTag Channel;
+		FName GameplayMessageStructName;
+		FWeakObjectPtr GameplayMessageStructType;
+		const FDanzmannNativeGameplayMessageType* NativeGameplayMessageType = nullptr;
+		uint64 Frame = 0;
+		uint32 PayloadSize = 0;
+		alignas(16) uint8 Payload[FlightRecorderPayloadSize];
+	};
+
+	/**
+	 * Slot of the flight recorder ring.
+	 */
+	struct FFlightRecorderEntry
+	{
+		/**
+		 * Odd while record is being written, 2 * (N + 1) once the Nth broadcast is recorded. Lets dumps running on other threads skip torn records.
+		 */
+		std::atomic<uint32> Sequence = 0;
+
+		FFlightRecorderRecord Record;
+	};
+
+	/**
+	 * Ring of the last broadcasts. Only written from the game thread, may be read from any thread.
+	 */
+	struct FFlightRecorder
+	{
+		FFlightRecorderEntry Entries[FlightRecorderCapacity];
+
+		/**
+		 * Number of broadcasts recorded so far, the next one is written at NumRecorded % FlightRecorderCapacity.
+		 */
+		std::atomic<uint32> NumRecorded = 0;
+	};
+
+	extern FFlightRecorder GFlightRecorder;
+	extern bool GFlightRecorderEnabled;
+
+	/**
+	 * Record a broadcast: a handful of stores and a copy of at most FlightRecorderPayloadSize bytes, no allocation nor lock.
+	 * @param Channel Channel Gameplay Message is broadcast on.
+	 * @param GameplayMessageStructType Gameplay Message struct type, nullptr if it's a native Gameplay Message.
+	 * @param GameplayMessagePayload Gameplay Message.
+	 * @param NativeGameplayMessageType Native Gameplay Message type, if it's a native Gameplay Message.
+	 */
+	FORCEINLINE void RecordBroadcast(const FGameplayTag Channel, const UScriptStruct* GameplayMessageStructType, const void* GameplayMessagePayload, const FDanzmannNativeGameplayMessageType* NativeGameplayMessageType)
+	{
+		if (!GFlightRecorderEnabled)
+		{
+			return;
+		}
+
+		const uint32 Index = GFlightRecorder.NumRecorded.load(std::memory_order_relaxed);
+		FFlightRecorderEntry& Entry = GFlightRecorder.Entries[Index & (FlightRecorderCapacity - 1)];
+		Entry.Sequence.store((2 * Index) + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		FFlightRecorderRecord& Record = Entry.Record;
+		Record.Channel = Channel;
+		Record.GameplayMessageStructName = GameplayMessageStructType != nullptr ? GameplayMessageStructType->GetFName() : NAME_None;
+		Record.GameplayMessageStructType = GameplayMessageStructType;
+		Record.NativeGameplayMessageType = NativeGameplayMessageType;
+		Record.Frame = GFrameCounter;
+
+		const uint32 GameplayMessageSize = NativeGameplayMessageType != nullptr ? NativeGameplayMessageType->Size : (GameplayMessageStructType != nullptr ? static_cast<uint32>(GameplayMessageStructType->GetStructureSize()) : 0);
+		Record.PayloadSize = GameplayMessagePayload != nullptr ? FMath::Min(GameplayMessageSize, FlightRecorderPayloadSize) : 0;
+		if (Record.PayloadSize > 0)
+		{
+			FMemory::Memcpy(Record.Payload, GameplayMessagePayload, Record.PayloadSize);
+		}
+
+		Entry.Sequence.store(2 * (Index + 1), std::memory_order_release);
+		GFlightRecorder.NumRecorded.store(Index + 1, std::memory_order_release);
+	}
+
+	/**
+	 * Log every broadcast recorded, from oldest to newest.
+	 * @param Reason Why flight recorder is dumped (e.g., crash, ensure).
+	 */
+	void DumpFlightRecorder(const TCHAR* Reason);
+
+	/**
+	 * Dump flight recorder when the process crashes.
+	 * @see FCoreDelegates::OnHandleSystemError.
+	 */
+	void HandleFlightRecorderSystemError();
+
+	/**
+	 * Dump flight recorder when an ensure fails.
+	 * @see FCoreDelegates::OnHandleSystemEnsure.
+	 */
+	void HandleFlightRecorderSystemEnsure();
+}
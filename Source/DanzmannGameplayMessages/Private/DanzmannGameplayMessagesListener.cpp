@@ -0,0 +1,125 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesListener.h"
+#include "DanzmannLogGameplayMessages.h"
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+
+TSharedPtr<FDanzmannGameplayMessagesScriptListener> FDanzmannGameplayMessagesScriptListener::Create(UObject* Object, const FName FunctionName)
+{
+	if (!IsValid(Object))
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Error, TEXT("[%hs] Listener object is not valid."), __FUNCTION__);
+		return nullptr;
+	}
+
+	UFunction* Function = Object->FindFunction(FunctionName);
+	if (Function == nullptr)
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Error, TEXT("[%hs] Function %s couldn't be found on %s."), __FUNCTION__, *FunctionName.ToString(), *GetPathNameSafe(Object));
+		return nullptr;
+	}
+
+	// Validate signature once, so nothing has to be checked when delivering Gameplay Messages: (FGameplayTag Channel, const FGameplayMessage& GameplayMessage)
+	const FStructProperty* ChannelProperty = nullptr;
+	const FStructProperty* GameplayMessageProperty = nullptr;
+	int32 NumParameters = 0;
+	for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+	{
+		const FProperty* Property = *It;
+		const bool bIsOutput = Property->HasAnyPropertyFlags(CPF_ReturnParm) || (Property->HasAnyPropertyFlags(CPF_OutParm) && !Property->HasAnyPropertyFlags(CPF_ConstParm));
+		const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+
+		if (bIsOutput || (StructProperty == nullptr))
+		{
+			NumParameters = INDEX_NONE;
+			break;
+		}
+
+		if (NumParameters == 0)
+		{
+			ChannelProperty = StructProperty;
+		}
+		else if (NumParameters == 1)
+		{
+			GameplayMessageProperty = StructProperty;
+		}
+
+		++NumParameters;
+	}
+
+	if ((NumParameters != 2) || (ChannelProperty->Struct != TBaseStructure<FGameplayTag>::Get()))
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Error, TEXT("[%hs] Function %s on %s must take exactly a FGameplayTag channel and a Gameplay Message struct as parameters."), __FUNCTION__, *FunctionName.ToString(), *GetPathNameSafe(Object));
+		return nullptr;
+	}
+
+	TSharedPtr<FDanzmannGameplayMessagesScriptListener> ScriptListener = MakeShared<FDanzmannGameplayMessagesScriptListener>();
+	ScriptListener->Object = Object;
+	ScriptListener->Function = Function;
+	ScriptListener->ChannelProperty = ChannelProperty;
+	ScriptListener->GameplayMessageProperty = GameplayMessageProperty;
+	ScriptListener->ParmsSize = Function->ParmsSize;
+	ScriptListener->ParmsAlignment = Function->GetMinAlignment();
+
+	// Initialize parameter frame once, deliveries only copy into it
+	ScriptListener->Parms = static_cast<uint8*>(FMemory::Malloc(FMath::Max(ScriptListener->ParmsSize, 1), ScriptListener->ParmsAlignment));
+	FMemory::Memzero(ScriptListener->Parms, ScriptListener->ParmsSize);
+	ChannelProperty->InitializeValue_InContainer(ScriptListener->Parms);
+	GameplayMessageProperty->InitializeValue_InContainer(ScriptListener->Parms);
+
+	return ScriptListener;
+}
+
+FDanzmannGameplayMessagesScriptListener::~FDanzmannGameplayMessagesScriptListener()
+{
+	if (Parms != nullptr)
+	{
+		// Properties are owned by the function, they can only be used to destroy parameter values while it's still around
+		if (Function.IsValid())
+		{
+			ChannelProperty->DestroyValue_InContainer(Parms);
+			GameplayMessageProperty->DestroyValue_InContainer(Parms);
+		}
+
+		FMemory::Free(Parms);
+	}
+}
+
+void FDanzmannGameplayMessagesScriptListener::Invoke(const FGameplayTag Channel, const void* GameplayMessagePayload) const
+{
+	UObject* StrongObject = Object.Get();
+	UFunction* StrongFunction = Function.Get();
+	if ((StrongObject == nullptr) || (StrongFunction == nullptr))
+	{
+		return;
+	}
+
+	if (!bIsInvoking)
+	{
+		// Copy into the parameter frame initialized at registration
+		TGuardValue<bool> InvokingGuard(bIsInvoking, true);
+		ChannelProperty->CopyCompleteValue(ChannelProperty->ContainerPtrToValuePtr<void>(Parms), &Channel);
+		GameplayMessageProperty->CopyCompleteValue(GameplayMessageProperty->ContainerPtrToValuePtr<void>(Parms), GameplayMessagePayload);
+
+		StrongObject->ProcessEvent(StrongFunction, Parms);
+	}
+	else
+	{
+		// Re-entrant delivery: the shared frame is still referenced by the outer call, use a temporary one built from the same cached layout
+		uint8* TemporaryParms = static_cast<uint8*>(FMemory_Alloca_Aligned(ParmsSize, ParmsAlignment));
+		FMemory::Memzero(TemporaryParms, ParmsSize);
+		ChannelProperty->CopyCompleteValue(ChannelProperty->ContainerPtrToValuePtr<void>(TemporaryParms), &Channel);
+		GameplayMessageProperty->InitializeValue_InContainer(TemporaryParms);
+		GameplayMessageProperty->CopyCompleteValue(GameplayMessageProperty->ContainerPtrToValuePtr<void>(TemporaryParms), GameplayMessagePayload);
+
+		StrongObject->ProcessEvent(StrongFunction, TemporaryParms);
+
+		GameplayMessageProperty->DestroyValue_InContainer(TemporaryParms);
+	}
+}
+
+const UScriptStruct* FDanzmannGameplayMessagesScriptListener::GetGameplayMessageStructType() const
+{
+	return GameplayMessageProperty != nullptr ? GameplayMessageProperty->Struct.Get() : nullptr;
+}
@@ -0,0 +1,90 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesListenerFilter.h"
+
+#if PLATFORM_ALWAYS_HAS_AVX_2
+	#include <immintrin.h>
+#elif PLATFORM_CPU_X86_FAMILY
+	#include <emmintrin.h>
+#endif
+
+namespace DanzmannGameplayMessages::Private
+{
+	namespace
+	{
+		/**
+		 * Scalar filter for a range of listeners. Used as fallback and for what's left after the vectorized loop.
+		 */
+		void FilterListeners_Scalar(const uint32* TypeKeys, const uint32* Flags, const int32 Begin, const int32 End, const uint32 BroadcastTypeKey, const uint32 RequiredFlags, const uint32 WildcardFlags, uint32* OutFastWords, uint32* OutSlowWords)
+		{
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				if ((Flags[Index] & RequiredFlags) != RequiredFlags)
+				{
+					continue;
+				}
+
+				const uint32 Bit = 1u << (Index & 31);
+				if ((TypeKeys[Index] == BroadcastTypeKey) || ((Flags[Index] & WildcardFlags) != 0))
+				{
+					OutFastWords[Index >> 5] |= Bit;
+				}
+				else
+				{
+					OutSlowWords[Index >> 5] |= Bit;
+				}
+			}
+		}
+	}
+
+	void FilterListeners(const uint32* TypeKeys, const uint32* Flags, const int32 Num, const uint32 BroadcastTypeKey, const uint32 RequiredFlags, const uint32 WildcardFlags, uint32* OutFastWords, uint32* OutSlowWords)
+	{
+		int32 Index = 0;
+
+		#if PLATFORM_ALWAYS_HAS_AVX_2
+			// 8 listeners per iteration. Lanes are all ones where condition holds, movemask then packs lane sign bits into the masks
+			const __m256i TypeKeyVector = _mm256_set1_epi32(static_cast<int32>(BroadcastTypeKey));
+			const __m256i RequiredVector = _mm256_set1_epi32(static_cast<int32>(RequiredFlags));
+			const __m256i WildcardVector = _mm256_set1_epi32(static_cast<int32>(WildcardFlags));
+			const __m256i ZeroVector = _mm256_setzero_si256();
+			for (; Index + 8 <= Num; Index += 8)
+			{
+				const __m256i TypeKeysLanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(TypeKeys + Index));
+				const __m256i FlagsLanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Flags + Index));
+
+				const __m256i bHasRequiredFlags = _mm256_cmpeq_epi32(_mm256_and_si256(FlagsLanes, RequiredVector), RequiredVector);
+				const __m256i bIsNotWildcard = _mm256_cmpeq_epi32(_mm256_and_si256(FlagsLanes, WildcardVector), ZeroVector);
+				const __m256i bTypeKeyMatches = _mm256_cmpeq_epi32(TypeKeysLanes, TypeKeyVector);
+				const __m256i bIsFastMatch = _mm256_andnot_si256(_mm256_andnot_si256(bTypeKeyMatches, bIsNotWildcard), bHasRequiredFlags);
+				const __m256i bIsSlowMatch = _mm256_andnot_si256(bIsFastMatch, bHasRequiredFlags);
+
+				const uint32 Shift = Index & 31;
+				OutFastWords[Index >> 5] |= static_cast<uint32>(_mm256_movemask_ps(_mm256_castsi256_ps(bIsFastMatch))) << Shift;
+				OutSlowWords[Index >> 5] |= static_cast<uint32>(_mm256_movemask_ps(_mm256_castsi256_ps(bIsSlowMatch))) << Shift;
+			}
+		#elif PLATFORM_CPU_X86_FAMILY
+			// 4 listeners per iteration. Lanes are all ones where condition holds, movemask then packs lane sign bits into the masks
+			const __m128i TypeKeyVector = _mm_set1_epi32(static_cast<int32>(BroadcastTypeKey));
+			const __m128i RequiredVector = _mm_set1_epi32(static_cast<int32>(RequiredFlags));
+			const __m128i WildcardVector = _mm_set1_epi32(static_cast<int32>(WildcardFlags));
+			const __m128i ZeroVector = _mm_setzero_si128();
+			for (; Index + 4 <= Num; Index += 4)
+			{
+				const __m128i TypeKeysLanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(TypeKeys + Index));
+				const __m128i FlagsLanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Flags + Index));
+
+				const __m128i bHasRequiredFlags = _mm_cmpeq_epi32(_mm_and_si128(FlagsLanes, RequiredVector), RequiredVector);
+				const __m128i bIsNotWildcard = _mm_cmpeq_epi32(_mm_and_si128(FlagsLanes, WildcardVector), ZeroVector);
+				const __m128i bTypeKeyMatches = _mm_cmpeq_epi32(TypeKeysLanes, TypeKeyVector);
+				const __m128i bIsFastMatch = _mm_andnot_si128(_mm_andnot_si128(bTypeKeyMatches, bIsNotWildcard), bHasRequiredFlags);
+				const __m128i bIsSlowMatch = _mm_andnot_si128(bIsFastMatch, bHasRequiredFlags);
+
+				const uint32 Shift = Index & 31;
+				OutFastWords[Index >> 5] |= static_cast<uint32>(_mm_movemask_ps(_mm_castsi128_ps(bIsFastMatch))) << Shift;
+				OutSlowWords[Index >> 5] |= static_cast<uint32>(_mm_movemask_ps(_mm_castsi128_ps(bIsSlowMatch))) << Shift;
+			}
+		#endif
+
+		FilterListeners_Scalar(TypeKeys, Flags, Index, Num, BroadcastTypeKey, RequiredFlags, WildcardFlags, OutFastWords, OutSlowWords);
+	}
+}
@@ -0,0 +1,66 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DanzmannGameplayMessagesListener.h"
+
+namespace DanzmannGameplayMessages::Private
+{
+	/**
+	 * Bits packed per listener alongside its type key, so channel listeners can be filtered without touching their entries.
+	 */
+	namespace ListenerFlags
+	{
+		// Listener can receive Gameplay Messages
+		static constexpr uint32 Enabled = 1 << 0;
+
+		// Listener registered with EDanzmannGameplayMessagesMatchCriteria::PartialMatch
+		static constexpr uint32 PartialMatch = 1 << 1;
+
+		// Listener accepts Gameplay Messages of any UScriptStruct type
+		static constexpr uint32 Wildcard = 1 << 2;
+
+		// First of the bits telling which local players listener receives Gameplay Messages of. Shared listeners have every one of them set
+		static constexpr uint32 LocalPlayerShift = 8;
+
+		// Bits of every local player
+		static constexpr uint32 AllLocalPlayers = ((1u << DanzmannGameplayMessages::MaxLocalPlayers) - 1) << LocalPlayerShift;
+	}
+
+	/**
+	 * Get the listener flag of a local player. Required by broadcasts scoped to that local player, so listeners of other local players are filtered out along with type mismatches.
+	 * @param LocalPlayerIndex Local player index, must be lower than MaxLocalPlayers.
+	 * @return Local player flag.
+	 */
+	inline uint32 GetLocalPlayerFlag(const int32 LocalPlayerIndex)
+	{
+		return 1u << (ListenerFlags::LocalPlayerShift + LocalPlayerIndex);
+	}
+
+	/**
+	 * Compute the packed type key of a UScriptStruct Gameplay Message type. Keys may collide, so matches still have to be confirmed by caller.
+	 * @param GameplayMessageStructType Gameplay Message struct type.
+	 * @return Packed type key.
+	 */
+	inline uint32 GetStructTypeKey(const UScriptStruct* GameplayMessageStructType)
+	{
+		return PointerHash(GameplayMessageStructType);
+	}
+
+	/**
+	 * Filter a channel listeners by their packed type keys and flags, producing two bit masks (32 listeners per word):
+	 *  - Fast: enabled listeners matching the channel criteria whose type key matches the broadcast one (or that accept any type).
+	 *  - Slow: enabled listeners matching the channel criteria whose type key differs, which need a full type check (e.g., parent struct types or type mismatches).
+	 * Uses AVX2 or SSE2 when available and a scalar loop otherwise.
+	 * @param TypeKeys Packed type key of each listener.
+	 * @param Flags Packed ListenerFlags of each listener.
+	 * @param Num Number of listeners.
+	 * @param BroadcastTypeKey Packed type key of the broadcast Gameplay Message.
+	 * @param RequiredFlags Flags every selected listener must have.
+	 * @param WildcardFlags Flags that make a listener match any type key (0 if wildcards shouldn't be fast-matched).
+	 * @param OutFastWords Fast mask, must hold at least (Num + 31) / 32 zeroed words.
+	 * @param OutSlowWords Slow mask, must hold at least (Num + 31) / 32 zeroed words.
+	 */
+	void FilterListeners(const uint32* TypeKeys, const uint32* Flags, const int32 Num, const uint32 BroadcastTypeKey, const uint32 RequiredFlags, const uint32 WildcardFlags, uint32* OutFastWords, uint32* OutSlowWords);
+}
@@ -0,0 +1,50 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesRouterCache.h"
+#include "DanzmannGameplayMessagesGameInstanceSubsystem.h"
+#include "Engine/World.h"
+#include "UObject/ObjectKey.h"
+
+namespace DanzmannGameplayMessages::Private
+{
+	/**
+	 * Get routers cached by world. Only accessed from the game thread.
+	 * @return Cached routers.
+	 */
+	static TMap<TObjectKey<UWorld>, TWeakObjectPtr<UDanzmannGameplayMessagesGameInstanceSubsystem>>& GetCachedRouters()
+	{
+		static TMap<TObjectKey<UWorld>, TWeakObjectPtr<UDanzmannGameplayMessagesGameInstanceSubsystem>> CachedRouters;
+		return CachedRouters;
+	}
+
+	UDanzmannGameplayMessagesGameInstanceSubsystem* FindCachedRouter(const UWorld* World)
+	{
+		check(IsInGameThread());
+
+		const TWeakObjectPtr<UDanzmannGameplayMessagesGameInstanceSubsystem>* CachedRouter = GetCachedRouters().Find(World);
+		return CachedRouter != nullptr ? CachedRouter->Get() : nullptr;
+	}
+
+	void CacheRouter(const UWorld* World, UDanzmannGameplayMessagesGameInstanceSubsystem* Router)
+	{
+		check(IsInGameThread());
+
+		GetCachedRouters().Add(World, Router);
+	}
+
+	void RemoveCachedRouter(const UDanzmannGameplayMessagesGameInstanceSubsystem* Router)
+	{
+		for (auto It = GetCachedRouters().CreateIterator(); It; ++It)
+		{
+			if (!It->Value.IsValid() || (It->Value.Get() == Router))
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	void HandleRouterCacheWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+	{
+		GetCachedRouters().Remove(World);
+	}
+}
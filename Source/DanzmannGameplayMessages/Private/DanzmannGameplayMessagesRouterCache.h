@@ -0,0 +1,37 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UDanzmannGameplayMessagesGameInstanceSubsystem;
+class UWorld;
+
+namespace DanzmannGameplayMessages::Private
+{
+	/**
+	 * Find router cached for a world.
+	 * @param World World to find router of.
+	 * @return Cached router, nullptr if there is none or it's gone.
+	 */
+	UDanzmannGameplayMessagesGameInstanceSubsystem* FindCachedRouter(const UWorld* World);
+
+	/**
+	 * Cache router of a world.
+	 * @param World World router belongs to.
+	 * @param Router Router of World.
+	 */
+	void CacheRouter(const UWorld* World, UDanzmannGameplayMessagesGameInstanceSubsystem* Router);
+
+	/**
+	 * Remove every cache entry pointing to a router, once it's deinitialized.
+	 * @param Router Router being deinitialized.
+	 */
+	void RemoveCachedRouter(const UDanzmannGameplayMessagesGameInstanceSubsystem* Router);
+
+	/**
+	 * Remove cache entry of a world being cleaned up.
+	 * @see FWorldDelegates::OnWorldCleanup.
+	 */
+	void HandleRouterCacheWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+}
@@ -0,0 +1,15 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesSettings.h"
+
+UDanzmannGameplayMessagesSettings::UDanzmannGameplayMessagesSettings()
+{
+	CategoryName = TEXT("Plugins");
+	SectionName = TEXT("DanzmannGameplayMessages");
+}
+
+int32 UDanzmannGameplayMessagesSettings::GetListenerCapacityHint(const FGameplayTag Channel) const
+{
+	const int32* ListenerCapacityHint = ListenerCapacityHints.Find(Channel);
+	return ListenerCapacityHint != nullptr ? *ListenerCapacityHint : DefaultListenerCapacity;
+}
@@ -1,40 +1,344 @@
 // Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
 
 #include "DanzmannGameplayMessagesGameInstanceSubsystem.h"
+#include "DanzmannGameplayMessagesChannelManifest.h"
+#include "DanzmannGameplayMessagesFlightRecorder.h"
+#include "DanzmannGameplayMessagesListenerFilter.h"
+#include "DanzmannGameplayMessagesRouterCache.h"
+#include "DanzmannGameplayMessagesSettings.h"
+#include "DanzmannGameplayMessagesWorldSubsystem.h"
 #include "DanzmannLogGameplayMessages.h"
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
+#include "Engine/Level.h"
 #include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 #include "UObject/ScriptMacros.h"
 #include "UObject/Stack.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace DanzmannGameplayMessages::Private
+{
+	static TAutoConsoleVariable<FString> CVarChannelProfilePath(
+		TEXT("DanzmannGameplayMessages.ChannelProfile.Path"),
+		TEXT(""),
+		TEXT("Channel profile file loaded at startup to pre-specialize hot channels. Empty loads no channel profile, and saves to Saved/DanzmannGameplayMessages/ChannelProfile.bin.")
+	);
+
+	static TAutoConsoleVariable<bool> CVarSaveChannelProfileOnShutdown(
+		TEXT("DanzmannGameplayMessages.ChannelProfile.SaveOnShutdown"),
+		false,
+		TEXT("Whether channel broadcast frequency and fanout are saved to the channel profile file when the subsystem shuts down.")
+	);
+
+	static FAutoConsoleCommandWithWorldAndArgs CmdSaveChannelProfile(
+		TEXT("DanzmannGameplayMessages.ChannelProfile.Save"),
+		TEXT("Save channel broadcast frequency and fanout gathered so far by the Game Instance router. Optional argument: file to save to, defaults to DanzmannGameplayMessages.ChannelProfile.Path."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			const UGameInstance* GameInstance = World != nullptr ? World->GetGameInstance() : nullptr;
+			const UDanzmannGameplayMessagesGameInstanceSubsystem* Router = GameInstance != nullptr ? GameInstance->GetSubsystem<UDanzmannGameplayMessagesGameInstanceSubsystem>() : nullptr;
+			if (Router == nullptr)
+			{
+				UE_LOG(LogDanzmannGameplayMessages, Warning, TEXT("[%hs] No Game Instance router to save channel profile of."), __FUNCTION__);
+				return;
+			}
+
+			Router->SaveChannelProfile(!Args.IsEmpty() ? Args[0] : UDanzmannGameplayMessagesGameInstanceSubsystem::GetDefaultChannelProfilePath());
+		})
+	);
+
+	/**
+	 * Channel profile file identifier and version.
+	 */
+	static constexpr uint32 ChannelProfileMagic = 0x444D4350;
+	static constexpr int32 ChannelProfileVersion = 3;
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Initialize_Internal();
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::InitializeForWorld(UWorld* World)
+{
+	RoutedWorld = World;
+	bIsWorldRouter = true;
+
+	// World routers are cached as soon as their world is initialized
+	if (GetDefault<UDanzmannGameplayMessagesSettings>()->bRouteByWorld)
+	{
+		DanzmannGameplayMessages::Private::CacheRouter(World, this);
+	}
+
+	Initialize_Internal();
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::Initialize_Internal()
+{
+	bIsInitialized = true;
+
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &ThisClass::HandlePostGarbageCollect);
+
+	// Channel manifest is shared by every router, each one only keeps its struct types referenced
+	const FDanzmannChannelManifest& ChannelManifest = GetChannelManifest();
+	ChannelManifestStructTypes.Reset(ChannelManifest.GameplayMessageStructTypes.Num());
+	for (const TWeakObjectPtr<const UScriptStruct>& GameplayMessageStructType : ChannelManifest.GameplayMessageStructTypes)
+	{
+		if (const UScriptStruct* ResolvedStructType = GameplayMessageStructType.Get())
+		{
+			ChannelManifestStructTypes.Add(ResolvedStructType);
+		}
+	}
+
+	// Reserve everything up front, so registering listeners on level load doesn't keep growing and rehashing tables
+	const UDanzmannGameplayMessagesSettings* Settings = GetDefault<UDanzmannGameplayMessagesSettings>();
+	ListenerMap.Reserve(FMath::Max(Settings->ExpectedNumChannels, ChannelManifest.Channels.Num()));
+	OwnerListenerMap.Reserve(Settings->ExpectedNumListenerOwners);
+	for (FDanzmannDeferredGameplayMessageQueue& Queue : DeferredQueues)
+	{
+		Queue.GameplayMessages.Reserve(Settings->DeferredQueueCapacity);
+	}
+
+	// Pre-specialize channels that were hot in the channel profile explicitly set up, if any. Channel profile belongs to the Game Instance router
+	const FString ChannelProfilePath = DanzmannGameplayMessages::Private::CVarChannelProfilePath.GetValueOnGameThread();
+	if (!bIsWorldRouter && !ChannelProfilePath.IsEmpty() && IFileManager::Get().FileExists(*ChannelProfilePath))
+	{
+		LoadChannelProfile(ChannelProfilePath);
+	}
+
+	// Game Instance router outlives travel on its own, only its retained Gameplay Messages may have to be cleared
+	if (!bIsWorldRouter)
+	{
+		SeamlessTravelTransitionHandle = FWorldDelegates::OnSeamlessTravelTransition.AddUObject(this, &ThisClass::HandleSeamlessTravelTransition);
+	}
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::TravelToWorld_Internal(UWorld* World)
+{
+	DanzmannGameplayMessages::Private::RemoveCachedRouter(this);
+
+	// Deliver anything still queued in the world being left, tick functions are registered again in the next world once something is queued
+	if (UWorld* TickWorld = DeliveryTickWorld.Get())
+	{
+		HandleWorldCleanup(TickWorld, false, false);
+	}
+
+	RoutedWorld = World;
+	if ((World != nullptr) && GetDefault<UDanzmannGameplayMessagesSettings>()->bRouteByWorld)
+	{
+		DanzmannGameplayMessages::Private::CacheRouter(World, this);
+	}
+}
+
+bool UDanzmannGameplayMessagesGameInstanceSubsystem::IsEmpty_Internal() const
+{
+	return (ListenerMap.Num() == 0) && (RetainedGameplayMessages.Num() == 0);
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::HandleSeamlessTravelTransition(UWorld* World)
+{
+	if ((World == nullptr) || (World->GetGameInstance() != GetGameInstance()))
+	{
+		return;
+	}
+
+	if (!GetDefault<UDanzmannGameplayMessagesSettings>()->bPersistAcrossSeamlessTravel)
+	{
+		RetainedGameplayMessages.Reset();
+	}
+}
 
 void UDanzmannGameplayMessagesGameInstanceSubsystem::Deinitialize()
 {
-	ListenerMap.Reset();
+	Shutdown_Internal();
 
 	Super::Deinitialize();
 }
 
+void UDanzmannGameplayMessagesGameInstanceSubsystem::Shutdown_Internal()
+{
+	if (!bIsInitialized)
+	{
+		return;
+	}
+
+	bIsInitialized = false;
+
+	if (!bIsWorldRouter && DanzmannGameplayMessages::Private::CVarSaveChannelProfileOnShutdown.GetValueOnGameThread())
+	{
+		SaveChannelProfile(GetDefaultChannelProfilePath());
+	}
+
+	DanzmannGameplayMessages::Private::RemoveCachedRouter(this);
+
+	UnregisterDeliveryTickFunctions();
+
+	if (PostGarbageCollectHandle.IsValid())
+	{
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+		PostGarbageCollectHandle.Reset();
+	}
+
+	if (WorldCleanupHandle.IsValid())
+	{
+		FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+		WorldCleanupHandle.Reset();
+	}
+
+	if (SeamlessTravelTransitionHandle.IsValid())
+	{
+		FWorldDelegates::OnSeamlessTravelTransition.Remove(SeamlessTravelTransitionHandle);
+		SeamlessTravelTransitionHandle.Reset();
+	}
+
+	// World router handed over on travel that no world picked up
+	if (TravelingRouter != nullptr)
+	{
+		TravelingRouter->Shutdown_Internal();
+		TravelingRouter = nullptr;
+	}
+
+	for (FDanzmannDeferredGameplayMessageQueue& Queue : DeferredQueues)
+	{
+		Queue.TickFunction.Reset();
+		Queue.GameplayMessages.Reset();
+	}
+
+	ListenerMap.Reset();
+	OwnerListenerMap.Reset();
+	DeclaredChannelCaches.Reset();
+	RetainedGameplayMessages.Reset();
+	++ListenerMapGeneration;
+}
+
 UDanzmannGameplayMessagesGameInstanceSubsystem* UDanzmannGameplayMessagesGameInstanceSubsystem::Get(const UObject* WorldContextObject)
 {
 	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
 	checkf(IsValid(World), TEXT("[%hs] World is not valid."), __FUNCTION__);
 	
-	UDanzmannGameplayMessagesGameInstanceSubsystem* GameplayMessagesSubsystem = World->GetGameInstance()->GetSubsystem<UDanzmannGameplayMessagesGameInstanceSubsystem>();
-	checkf(IsValid(GameplayMessagesSubsystem), TEXT("[%hs] Gameplay Message Subsystem is not valid."), __FUNCTION__);
+	return Get(World);
+}
+
+UDanzmannGameplayMessagesGameInstanceSubsystem* UDanzmannGameplayMessagesGameInstanceSubsystem::Get(const UWorld* World)
+{
+	checkf(World != nullptr, TEXT("[%hs] World is not valid."), __FUNCTION__);
+
+	UDanzmannGameplayMessagesGameInstanceSubsystem* GameplayMessagesSubsystem = FindRouter_Internal(World);
+	checkf(GameplayMessagesSubsystem != nullptr, TEXT("[%hs] Gameplay Message Subsystem is not valid."), __FUNCTION__);
 	
 	return GameplayMessagesSubsystem;
 }
 
+UDanzmannGameplayMessagesGameInstanceSubsystem* UDanzmannGameplayMessagesGameInstanceSubsystem::Get(TYPE_OF_NULLPTR)
+{
+	return Get(static_cast<const UWorld*>(nullptr));
+}
+
 bool UDanzmannGameplayMessagesGameInstanceSubsystem::HasInstance(const UObject* WorldContextObject)
 {
 	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
-	const UDanzmannGameplayMessagesGameInstanceSubsystem* GameplayMessagesSubsystem = IsValid(World) ? World->GetGameInstance()->GetSubsystem<UDanzmannGameplayMessagesGameInstanceSubsystem>() : nullptr;
-	return IsValid(GameplayMessagesSubsystem);
+	return HasInstance(World);
+}
+
+bool UDanzmannGameplayMessagesGameInstanceSubsystem::HasInstance(const UWorld* World)
+{
+	return (World != nullptr) && (FindRouter_Internal(World) != nullptr);
+}
+
+bool UDanzmannGameplayMessagesGameInstanceSubsystem::HasInstance(TYPE_OF_NULLPTR)
+{
+	return false;
+}
+
+UDanzmannGameplayMessagesGameInstanceSubsystem* UDanzmannGameplayMessagesGameInstanceSubsystem::FindRouter_Internal(const UWorld* World)
+{
+	// Router cache is only accessed from the game thread, other threads resolve router every time
+	if (!IsInGameThread())
+	{
+		return FindRouterUncached_Internal(World);
+	}
+
+	// Routers are only resolved the first time they're needed for a world, from then on it's a single lookup
+	if (UDanzmannGameplayMessagesGameInstanceSubsystem* CachedRouter = DanzmannGameplayMessages::Private::FindCachedRouter(World))
+	{
+		return CachedRouter;
+	}
+
+	UDanzmannGameplayMessagesGameInstanceSubsystem* Router = FindRouterUncached_Internal(World);
+	if (Router != nullptr)
+	{
+		DanzmannGameplayMessages::Private::CacheRouter(World, Router);
+	}
+
+	return Router;
+}
+
+UDanzmannGameplayMessagesGameInstanceSubsystem* UDanzmannGameplayMessagesGameInstanceSubsystem::FindRouterUncached_Internal(const UWorld* World)
+{
+	// Each world has its own listeners when routing by world, so traffic in one world never visits listeners of another
+	if (GetDefault<UDanzmannGameplayMessagesSettings>()->bRouteByWorld)
+	{
+		if (const UDanzmannGameplayMessagesWorldSubsystem* WorldSubsystem = World->GetSubsystem<UDanzmannGameplayMessagesWorldSubsystem>())
+		{
+			return WorldSubsystem->GetRouter();
+		}
+	}
+
+	const UGameInstance* GameInstance = World->GetGameInstance();
+	UDanzmannGameplayMessagesGameInstanceSubsystem* GameplayMessagesSubsystem = IsValid(GameInstance) ? GameInstance->GetSubsystem<UDanzmannGameplayMessagesGameInstanceSubsystem>() : nullptr;
+	return IsValid(GameplayMessagesSubsystem) ? GameplayMessagesSubsystem : nullptr;
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::BroadcastGameplayMessage(const FGameplayTag Channel, const FConstStructView GameplayMessage)
+{
+	if (GameplayMessage.IsValid())
+	{
+		BroadcastGameplayMessage_Internal(Channel, GameplayMessage.GetScriptStruct(), GameplayMessage.GetMemory());
+	}
+	else
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Error, TEXT("[%hs] Trying to broadcast an empty struct view on channel %s."), __FUNCTION__, *Channel.ToString());
+	}
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::BroadcastGameplayMessage(const FGameplayTag Channel, const FInstancedStruct& GameplayMessage)
+{
+	BroadcastGameplayMessage(Channel, FConstStructView(GameplayMessage));
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::BroadcastGameplayMessage(const FGameplayTag Channel, FInstancedStruct&& GameplayMessage)
+{
+	if (GameplayMessage.IsValid())
+	{
+		// Moving an instanced struct keeps its memory where it is, so payload stays valid for the rest of the broadcast even once moved into a queue
+		BroadcastGameplayMessage_Internal(Channel, GameplayMessage.GetScriptStruct(), GameplayMessage.GetMemory(), &GameplayMessage);
+	}
+	else
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Error, TEXT("[%hs] Trying to broadcast an empty instanced struct on channel %s."), __FUNCTION__, *Channel.ToString());
+	}
 }
 
-void UDanzmannGameplayMessagesGameInstanceSubsystem::BroadcastGameplayMessage_Internal(const FGameplayTag Channel, const UScriptStruct* GameplayMessageStructType, const void* GameplayMessagePayload)
+void UDanzmannGameplayMessagesGameInstanceSubsystem::BroadcastGameplayMessage_Internal(const FGameplayTag Channel, const UScriptStruct* GameplayMessageStructType, const void* GameplayMessagePayload, FInstancedStruct* OwnedGameplayMessage, const FDanzmannNativeGameplayMessageType* NativeGameplayMessageType, const FDanzmannGameplayMessageChannel* DeclaredChannel, const int32 LocalPlayerIndex)
 {
+	if (!FMath::IsWithin(LocalPlayerIndex, INDEX_NONE, DanzmannGameplayMessages::MaxLocalPlayers))
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Error, TEXT("[%hs] Trying to broadcast on channel %s to invalid local player %d, only the first %d local players are supported."), __FUNCTION__, *Channel.ToString(), LocalPlayerIndex, DanzmannGameplayMessages::MaxLocalPlayers);
+		return;
+	}
+
+	#if DANZMANN_GAMEPLAY_MESSAGES_FLIGHT_RECORDER
+		DanzmannGameplayMessages::Private::RecordBroadcast(Channel, GameplayMessageStructType, GameplayMessagePayload, NativeGameplayMessageType);
+	#endif
+
 	// Log the broadcast details if we have increased LogDanzmannGameplayMessages verbosity
 	if (UE_LOG_ACTIVE(LogDanzmannGameplayMessages, Verbose))
 	{
@@ -47,48 +351,178 @@ void UDanzmannGameplayMessagesGameInstanceSubsystem::BroadcastGameplayMessage_In
 			}
 		#endif
 
+		// Native Gameplay Messages have no reflection data to export, so only their type is logged
 		FString HumanReadableMessage;
-		GameplayMessageStructType->ExportText(
-			HumanReadableMessage,
-			GameplayMessagePayload,
-			nullptr,
-			nullptr,
-			PPF_None,
-			nullptr
-		);
+		if (NativeGameplayMessageType != nullptr)
+		{
+			HumanReadableMessage = FString::Printf(TEXT("native %s"), NativeGameplayMessageType->Name);
+		}
+		else
+		{
+			GameplayMessageStructType->ExportText(
+				HumanReadableMessage,
+				GameplayMessagePayload,
+				nullptr,
+				nullptr,
+				PPF_None,
+				nullptr
+			);
+		}
 		UE_LOG(LogDanzmannGameplayMessages, Verbose, TEXT("Broadcasting Gameplay Message (%s, %s, %s)..."), ContextString != nullptr ? **ContextString : *GetPathNameSafe(this), *Channel.ToString(), *HumanReadableMessage);
 	}
 
-	// Broadcast the Gameplay Message
-	bool bOnInitialTag = true;
-	for (FGameplayTag Tag = Channel; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+	#if !UE_BUILD_SHIPPING
+		// Validate Gameplay Message type against the one found in channel manifest, which is cheap as long as they match exactly
+		if (GameplayMessageStructType != nullptr)
+		{
+			if (const FDanzmannChannelManifestEntry* ManifestEntry = GetChannelManifest().Channels.Find(Channel))
+			{
+				const UScriptStruct* ManifestStructType = ManifestEntry->GameplayMessageStructType.Get();
+				if ((ManifestStructType != nullptr) && (ManifestStructType != GameplayMessageStructType) && !GameplayMessageStructType->IsChildOf(ManifestStructType))
+				{
+					UE_LOG(LogDanzmannGameplayMessages, Warning, TEXT("[%hs] Gameplay Message of type %s broadcast on channel %s, which expects type %s according to channel manifest."), __FUNCTION__, *GameplayMessageStructType->GetPathName(), *Channel.ToString(), *ManifestStructType->GetPathName());
+				}
+			}
+		}
+	#endif
+
+	// Shared copy of the Gameplay Message is only created if a consumer needs to keep it past the broadcast
+	FDanzmannGameplayMessageBroadcastContext Context;
+	Context.Channel = Channel;
+	Context.GameplayMessageStructType = GameplayMessageStructType;
+	Context.GameplayMessagePayload = GameplayMessagePayload;
+	Context.NativeGameplayMessageType = NativeGameplayMessageType;
+	Context.OwnedGameplayMessage = OwnedGameplayMessage;
+	for (int32& QueuedIndex : Context.QueuedIndices)
 	{
-		if (const FDanzmannChannelListenerList* ListenersList = ListenerMap.Find(Tag))
+		QueuedIndex = INDEX_NONE;
+	}
+
+	// Packed type key the broadcast Gameplay Message is filtered with. Native Gameplay Messages never fast-match wildcard listeners, those only receive UScriptStruct types
+	const uint32 BroadcastTypeKey = NativeGameplayMessageType != nullptr ? NativeGameplayMessageType->Id : DanzmannGameplayMessages::Private::GetStructTypeKey(GameplayMessageStructType);
+	const uint32 WildcardFlags = NativeGameplayMessageType != nullptr ? 0 : DanzmannGameplayMessages::Private::ListenerFlags::Wildcard;
+
+	// Broadcasts scoped to a local player require its flag, which only its own listeners and shared ones have
+	const uint32 LocalPlayerFlags = LocalPlayerIndex != INDEX_NONE ? DanzmannGameplayMessages::Private::GetLocalPlayerFlag(LocalPlayerIndex) : 0;
+
+	// Type keys may collide, a fast match only skips type checks once its exact type is confirmed from packed struct types, without resolving listener type
+	auto IsExactType =
+		[GameplayMessageStructType, NativeGameplayMessageType]
+		(const FDanzmannChannelListenerList& ListenersList, const int32 ListenerIndex)
 		{
-			// Copy in case there are removals while handling callbacks
-			TArray<FDanzmannGameplayMessagesListenerData> Listeners = ListenersList->Listeners;
+			const FDanzmannGameplayMessagesListenerData& Listener = ListenersList.Listeners[ListenerIndex];
+			return NativeGameplayMessageType != nullptr ?
+				(Listener.NativeGameplayMessageTypeId == NativeGameplayMessageType->Id) :
+				((Listener.NativeGameplayMessageTypeId == 0) && (!Listener.bHasValidType || (ListenersList.PackedStructTypes[ListenerIndex] == GameplayMessageStructType)));
+		};
 
-			for (const FDanzmannGameplayMessagesListenerData& Listener : Listeners)
+	// Checks a selected listener type (unless it's a confirmed exact match) and invokes it, or queues it for its tick group
+	auto DispatchToListener =
+		[this, &Context, Channel, GameplayMessageStructType, GameplayMessagePayload, NativeGameplayMessageType]
+		(const FDanzmannGameplayMessagesListenerData& Listener, const bool bIsExactType, const FGameplayTag Tag)
+		{
+			if (!bIsExactType)
 			{
-				if (bOnInitialTag || (Listener.MatchCriteria == EDanzmannGameplayMessagesMatchCriteria::PartialMatch))
+				// Native Gameplay Messages bypass reflection entirely: they only reach listeners of the exact same native type, and native listeners only receive those
+				if ((NativeGameplayMessageType != nullptr) || (Listener.NativeGameplayMessageTypeId != 0))
 				{
-					if (Listener.bHasValidType && !Listener.GameplayMessageStructType.IsValid())
+					if (Listener.bHasValidType || (Listener.NativeGameplayMessageTypeId != 0))
 					{
-						UE_LOG(LogDanzmannGameplayMessages, Warning, TEXT("[%hs] Listener Gameplay Message struct type has gone invalid on channel %s. Removing listener from list."), __FUNCTION__, *Channel.ToString());
-						UnregisterListener_Internal(Channel, Listener.HandleId);
-						continue;
+						const FString BroadcastTypeName = NativeGameplayMessageType != nullptr ? FString(NativeGameplayMessageType->Name) : GameplayMessageStructType->GetPathName();
+						const FString ListenerTypeName = Listener.NativeGameplayMessageTypeId != 0 ? Listener.NativeGameplayMessageTypeName.ToString() : GetPathNameSafe(Listener.GameplayMessageStructType.Get());
+						UE_LOG(LogDanzmannGameplayMessages, Error, TEXT("[%hs] Gameplay Message type mismatch on channel %s. Broadcast type %s, listener at %s was expecting type %s."), __FUNCTION__, *Channel.ToString(), *BroadcastTypeName, *Tag.ToString(), *ListenerTypeName);
 					}
 
-					// The receiving type must be either a parent of the sending type or completely ambiguous (for internal use)
-					if (!Listener.bHasValidType || GameplayMessageStructType->IsChildOf(Listener.GameplayMessageStructType.Get()))
-					{
-						Listener.Callback(Channel, GameplayMessageStructType, GameplayMessagePayload);
-					}
-					else
+					return;
+				}
+
+				if (Listener.bHasValidType && !Listener.GameplayMessageStructType.IsValid())
+				{
+					UE_LOG(LogDanzmannGameplayMessages, Warning, TEXT("[%hs] Listener Gameplay Message struct type has gone invalid on channel %s. Removing listener from list."), __FUNCTION__, *Channel.ToString());
+					UnregisterListener_Internal(Tag, Listener.HandleId);
+					return;
+				}
+
+				// The receiving type must be either a parent of the sending type or completely ambiguous (for internal use). Compatibility with channel manifest type is resolved at registration
+				if (Listener.bHasValidType && (Listener.ManifestGameplayMessageStructType != GameplayMessageStructType) && !GameplayMessageStructType->IsChildOf(Listener.GameplayMessageStructType.Get()))
+				{
+					UE_LOG(LogDanzmannGameplayMessages, Error, TEXT("[%hs] Gameplay Message struct type mismatch on channel %s. Broadcast type %s, listener at %s was expecting type %s."), __FUNCTION__, *Channel.ToString(), *GameplayMessageStructType->GetPathName(), *Tag.ToString(), *Listener.GameplayMessageStructType->GetPathName());
+					return;
+				}
+			}
+
+			// Listeners that asked for a specific tick group are invoked later on, when their tick function flushes the queue
+			if (Listener.DeliveryTickGroup != EDanzmannGameplayMessagesDeliveryTickGroup::Immediate)
+			{
+				if (EnqueueDeferredGameplayMessage(Listener.DeliveryTickGroup, Context, Tag, Listener.HandleId))
+				{
+					return;
+				}
+			}
+
+			InvokeListener_Internal(Listener, Channel, GameplayMessageStructType, GameplayMessagePayload);
+		};
+
+	// Broadcast the Gameplay Message. Declared channels already know their hierarchy and find their listener lists through their cache
+	const TConstArrayView<FGameplayTag> DeclaredHierarchy = DeclaredChannel != nullptr ? DeclaredChannel->GetHierarchy() : TConstArrayView<FGameplayTag>();
+	bool bOnInitialTag = true;
+	int32 Level = 0;
+	for (FGameplayTag Tag = Channel; Tag.IsValid(); ++Level, Tag = DeclaredChannel != nullptr ? (DeclaredHierarchy.IsValidIndex(Level) ? DeclaredHierarchy[Level] : FGameplayTag()) : Tag.RequestDirectParent())
+	{
+		if (FDanzmannChannelListenerList* ListenersList = DeclaredChannel != nullptr ? FindDeclaredChannelList_Internal(*DeclaredChannel, Level) : ListenerMap.Find(Tag))
+		{
+			const int32 NumListeners = ListenersList->Listeners.Num();
+			const uint32 RequiredFlags = DanzmannGameplayMessages::Private::ListenerFlags::Enabled | LocalPlayerFlags | (bOnInitialTag ? 0 : DanzmannGameplayMessages::Private::ListenerFlags::PartialMatch);
+
+			// Hot channel with a single listener: check its packed metadata and invoke it directly
+			if (ListenersList->DispatchMode == EDanzmannChannelDispatchMode::SingleListener)
+			{
+				const uint32 PackedFlags = ListenersList->PackedFlags[0];
+				const bool bIsSelected = (PackedFlags & RequiredFlags) == RequiredFlags;
+
+				// Channel may cool down and go back to filtered dispatch, which only applies to next broadcast
+				RecordChannelBroadcast(*ListenersList, bIsSelected ? 1 : 0);
+
+				if (bIsSelected)
+				{
+					const bool bIsFastMatch = (ListenersList->PackedTypeKeys[0] == BroadcastTypeKey) || ((PackedFlags & WildcardFlags) != 0);
+					const bool bIsExactType = bIsFastMatch && IsExactType(*ListenersList, 0);
+
+					// Copy in case it's removed while handling callback
+					const FDanzmannGameplayMessagesListenerData Listener = ListenersList->Listeners[0];
+					DispatchToListener(Listener, bIsExactType, Tag);
+				}
+			}
+			else
+			{
+				// Select listeners to invoke from packed metadata first: fast matches have the exact broadcast type, slow ones need a full type check
+				const int32 NumWords = (NumListeners + 31) / 32;
+				TArray<uint32, TInlineAllocator<4>> FastWords;
+				TArray<uint32, TInlineAllocator<4>> SlowWords;
+				FastWords.SetNumZeroed(NumWords);
+				SlowWords.SetNumZeroed(NumWords);
+				DanzmannGameplayMessages::Private::FilterListeners(ListenersList->PackedTypeKeys.GetData(), ListenersList->PackedFlags.GetData(), NumListeners, BroadcastTypeKey, RequiredFlags, WildcardFlags, FastWords.GetData(), SlowWords.GetData());
+
+				// Copy selected listeners in case there are removals while handling callbacks
+				TArray<TPair<FDanzmannGameplayMessagesListenerData, bool>, TInlineAllocator<8>> Listeners;
+				for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+				{
+					for (uint32 Word = FastWords[WordIndex] | SlowWords[WordIndex]; Word != 0; Word &= Word - 1)
 					{
-						UE_LOG(LogDanzmannGameplayMessages, Error, TEXT("[%hs] Gameplay Message struct type mismatch on channel %s. Broadcast type %s, listener at %s was expecting type %s."), __FUNCTION__, *Channel.ToString(), *GameplayMessageStructType->GetPathName(), *Tag.ToString(), *Listener.GameplayMessageStructType->GetPathName());
+						const int32 BitIndex = FMath::CountTrailingZeros(Word);
+						const int32 ListenerIndex = (WordIndex * 32) + BitIndex;
+						const bool bIsFastMatch = (FastWords[WordIndex] & (1u << BitIndex)) != 0;
+						Listeners.Emplace(ListenersList->Listeners[ListenerIndex], bIsFastMatch && IsExactType(*ListenersList, ListenerIndex));
 					}
 				}
+
+				// Gather stats before any callback can invalidate the list, hot channels switch to a specialized dispatch mode
+				RecordChannelBroadcast(*ListenersList, Listeners.Num());
+
+				for (const TPair<FDanzmannGameplayMessagesListenerData, bool>& SelectedListener : Listeners)
+				{
+					DispatchToListener(SelectedListener.Key, SelectedListener.Value, Tag);
+				}
 			}
 		}
 		
@@ -130,52 +564,818 @@ DEFINE_FUNCTION(UDanzmannGameplayMessagesGameInstanceSubsystem::execBP_Broadcast
 	}
 }
 
-FDanzmannGameplayMessagesListenerHandle UDanzmannGameplayMessagesGameInstanceSubsystem::RegisterListener_Internal(const FGameplayTag Channel, TFunction<void(FGameplayTag, const UScriptStruct*, const void*)>&& Callback, const UScriptStruct* GameplayMessageStructType, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria)
+void UDanzmannGameplayMessagesGameInstanceSubsystem::BP_BroadcastGameplayMessageToLocalPlayer(const FGameplayTag Channel, const int32 LocalPlayerIndex, const int32& GameplayMessage)
+{
+	// This will never be called, the exec version below will be hit instead
+	checkNoEntry();
+}
+
+DEFINE_FUNCTION(UDanzmannGameplayMessagesGameInstanceSubsystem::execBP_BroadcastGameplayMessageToLocalPlayer)
 {
-	FDanzmannChannelListenerList& ListenersList = ListenerMap.FindOrAdd(Channel);
+	P_GET_STRUCT(FGameplayTag, Channel);
+	P_GET_PROPERTY(FIntProperty, LocalPlayerIndex);
 
-	FDanzmannGameplayMessagesListenerData& Entry = ListenerMap.FindOrAdd(Channel).Listeners.AddDefaulted_GetRef();
-	Entry.Callback = MoveTemp(Callback);
-	Entry.GameplayMessageStructType = GameplayMessageStructType;
-	Entry.bHasValidType = GameplayMessageStructType != nullptr;
-	Entry.HandleId = ++ListenersList.AvailableHandleId;
-	Entry.MatchCriteria = ChannelMatchCriteria;
+	// Same parsing as execBP_BroadcastGameplayMessage, wildcard payload comes last
+	Stack.MostRecentPropertyAddress = nullptr;
+	Stack.StepCompiledIn<FStructProperty>(nullptr);
+	const void* GameplayMessagePtr = Stack.MostRecentPropertyAddress;
+	const FStructProperty* StructProperty = CastField<FStructProperty>(Stack.MostRecentProperty);
+
+	P_FINISH;
 
-	return FDanzmannGameplayMessagesListenerHandle(Channel, Entry.HandleId);
+	if (ensureMsgf((StructProperty != nullptr) && (StructProperty->Struct != nullptr) && (GameplayMessagePtr != nullptr), TEXT("Dancing Man Gameplay Messages | %s class calls %s function with an invalid type into \"Gameplay Message\" wildcard parameter. Its type must be of UScriptStruct (USTRUCT())."), *Stack.Object->GetClass()->GetName(), *Stack.CurrentNativeFunction->GetName()))
+	{
+		P_THIS->BroadcastGameplayMessage_Internal(Channel, StructProperty->Struct, GameplayMessagePtr, nullptr, nullptr, nullptr, LocalPlayerIndex);
+	}
 }
 
-void UDanzmannGameplayMessagesGameInstanceSubsystem::UnregisterListener(const FDanzmannGameplayMessagesListenerHandle Handle)
+FDanzmannGameplayMessagesListenerHandle UDanzmannGameplayMessagesGameInstanceSubsystem::RegisterListener_Internal(const FGameplayTag Channel, FDanzmannGameplayMessagesListenerData&& ListenerData, const UScriptStruct* GameplayMessageStructType, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria, const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup, const int32 LocalPlayerIndex, const FDanzmannNativeGameplayMessageType* NativeGameplayMessageType)
 {
-	if (Handle.IsValid())
+	if (!ensureMsgf(FMath::IsWithin(LocalPlayerIndex, INDEX_NONE, DanzmannGameplayMessages::MaxLocalPlayers), TEXT("Dancing Man Gameplay Messages | Listener on channel %s is scoped to invalid local player %d, only the first %d local players are supported."), *Channel.ToString(), LocalPlayerIndex, DanzmannGameplayMessages::MaxLocalPlayers))
 	{
-		UnregisterListener_Internal(Handle.Channel, Handle.Id);
+		return FDanzmannGameplayMessagesListenerHandle();
 	}
-	else
+
+	// Native type IDs are hashed from type names, make sure two different types never end up sharing one
+	if (NativeGameplayMessageType != nullptr)
 	{
-		UE_LOG(LogDanzmannGameplayMessages, Warning, TEXT("[%hs] Trying to unregister an invalid handle."), __FUNCTION__);
+		const FName NativeGameplayMessageTypeName(NativeGameplayMessageType->Name);
+		const FName& KnownTypeName = NativeGameplayMessageTypeNames.FindOrAdd(NativeGameplayMessageType->Id, NativeGameplayMessageTypeName);
+		ensureMsgf(KnownTypeName == NativeGameplayMessageTypeName, TEXT("Dancing Man Gameplay Messages | Native Gameplay Message types %s and %s share the same type ID. Rename one of them."), *KnownTypeName.ToString(), *NativeGameplayMessageTypeName.ToString());
 	}
-}
 
-void UDanzmannGameplayMessagesGameInstanceSubsystem::UnregisterListener_Internal(const FGameplayTag Channel, int32 HandleId)
-{
-	if (FDanzmannChannelListenerList* ListenersList = ListenerMap.Find(Channel))
+	FDanzmannChannelListenerList* ExistingListenersList = ListenerMap.Find(Channel);
+	FDanzmannChannelListenerList& ListenersList = ExistingListenersList != nullptr ? *ExistingListenersList : ListenerMap.Add(Channel);
+	if (ExistingListenersList == nullptr)
 	{
-		const int32 MatchIndex = ListenersList->Listeners.IndexOfByPredicate(
-			[Id = HandleId]
-			(const FDanzmannGameplayMessagesListenerData& Other)
-			{
-				return Other.HandleId == Id;
-			}
-		);
-		
-		if (MatchIndex != INDEX_NONE)
+		// Adding a channel list may move every other one
+		++ListenerMapGeneration;
+
+		// Size new channel lists from their capacity hint, so they don't grow one listener at a time
+		const FDanzmannChannelManifestEntry* ManifestEntry = GetChannelManifest().Channels.Find(Channel);
+		const int32 ListenerCapacityHint = FMath::Max(GetDefault<UDanzmannGameplayMessagesSettings>()->GetListenerCapacityHint(Channel), ManifestEntry != nullptr ? ManifestEntry->NumListeners : 0);
+		ListenersList.Listeners.Reserve(ListenerCapacityHint);
+		ListenersList.PackedTypeKeys.Reserve(ListenerCapacityHint);
+		ListenersList.PackedStructTypes.Reserve(ListenerCapacityHint);
+		ListenersList.PackedFlags.Reserve(ListenerCapacityHint);
+
+		// Channel stats carry on from the last time it had listeners, or from the loaded channel profile
+		if (const FDanzmannChannelStats* ProfiledStats = ChannelProfile.Find(Channel))
 		{
-			ListenersList->Listeners.RemoveAtSwap(MatchIndex);
+			ListenersList.Stats = *ProfiledStats;
+			ListenersList.Stats.WindowStartFrame = GFrameCounter;
+			ListenersList.Stats.WindowNumBroadcasts = 0;
+			ListenersList.bIsHot = ListenersList.Stats.RecentBroadcastsPerFrame >= HotChannelBroadcastsPerFrame;
+			ChannelProfile.Remove(Channel);
 		}
+	}
 
-		if (ListenersList->Listeners.Num() == 0)
+	FDanzmannGameplayMessagesListenerData& Entry = ListenersList.Listeners.Add_GetRef(MoveTemp(ListenerData));
+	Entry.GameplayMessageStructType = GameplayMessageStructType;
+	Entry.bHasValidType = GameplayMessageStructType != nullptr;
+	Entry.HandleId = ++AvailableHandleId;
+	Entry.MatchCriteria = ChannelMatchCriteria;
+	Entry.DeliveryTickGroup = DeliveryTickGroup;
+	Entry.NativeGameplayMessageTypeId = NativeGameplayMessageType != nullptr ? NativeGameplayMessageType->Id : 0;
+	Entry.NativeGameplayMessageTypeName = NativeGameplayMessageType != nullptr ? FName(NativeGameplayMessageType->Name) : NAME_None;
+
+	// Resolve once whether Gameplay Messages of the type channel manifest expects can be delivered to listener
+	if (GameplayMessageStructType != nullptr)
+	{
+		if (const FDanzmannChannelManifestEntry* ManifestEntry = GetChannelManifest().Channels.Find(Channel))
 		{
-			ListenerMap.Remove(Channel);
+			const UScriptStruct* ManifestStructType = ManifestEntry->GameplayMessageStructType.Get();
+			if ((ManifestStructType != nullptr) && ManifestStructType->IsChildOf(GameplayMessageStructType))
+			{
+				Entry.ManifestGameplayMessageStructType = ManifestStructType;
+			}
 		}
 	}
+
+	// Keep packed metadata in sync so broadcasts can filter this listener without touching its entry
+	uint32 PackedFlags = DanzmannGameplayMessages::Private::ListenerFlags::Enabled;
+	if (ChannelMatchCriteria == EDanzmannGameplayMessagesMatchCriteria::PartialMatch)
+	{
+		PackedFlags |= DanzmannGameplayMessages::Private::ListenerFlags::PartialMatch;
+	}
+	if ((GameplayMessageStructType == nullptr) && (NativeGameplayMessageType == nullptr))
+	{
+		PackedFlags |= DanzmannGameplayMessages::Private::ListenerFlags::Wildcard;
+	}
+	PackedFlags |= LocalPlayerIndex != INDEX_NONE ? DanzmannGameplayMessages::Private::GetLocalPlayerFlag(LocalPlayerIndex) : DanzmannGameplayMessages::Private::ListenerFlags::AllLocalPlayers;
+
+	ListenersList.PackedTypeKeys.Add(NativeGameplayMessageType != nullptr ? NativeGameplayMessageType->Id : DanzmannGameplayMessages::Private::GetStructTypeKey(GameplayMessageStructType));
+	ListenersList.PackedStructTypes.Add(GameplayMessageStructType);
+	bHasCollectableListenerTypes |= (GameplayMessageStructType != nullptr) && !GameplayMessageStructType->IsNative();
+	ListenersList.PackedFlags.Add(PackedFlags);
+	UpdateDispatchMode(ListenersList);
+
+	const FDanzmannGameplayMessagesListenerHandle Handle(Channel, Entry.HandleId);
+
+	// Index listener by owner, if it has one, so it can be removed along with every other listener of that owner
+	if (const UObject* Owner = Entry.Object.Get())
+	{
+		Entry.OwnerKey = FObjectKey(Owner);
+		OwnerListenerMap.FindOrAdd(Entry.OwnerKey).Add(Handle);
+	}
+
+	return Handle;
+}
+
+FDanzmannGameplayMessagesListenerHandle UDanzmannGameplayMessagesGameInstanceSubsystem::RegisterListener(const FGameplayTag Channel, const UScriptStruct* GameplayMessageStructType, TFunction<void(const FGameplayTag, const FConstStructView)>&& Callback, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria, const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup, const int32 LocalPlayerIndex)
+{
+	auto GenericCallback =
+		[RegisteredCallback = MoveTemp(Callback)]
+		(const FGameplayTag ChannelToRegister, const UScriptStruct* ReceivedStructType, const void* ReceivedPayload)
+		{
+			RegisteredCallback(ChannelToRegister, FConstStructView(ReceivedStructType, static_cast<const uint8*>(ReceivedPayload)));
+		};
+
+	FDanzmannGameplayMessagesListenerData ListenerData;
+	ListenerData.Callback = MoveTemp(GenericCallback);
+
+	return RegisterListener_Internal(Channel, MoveTemp(ListenerData), GameplayMessageStructType, ChannelMatchCriteria, DeliveryTickGroup, LocalPlayerIndex);
+}
+
+FDanzmannGameplayMessagesListenerHandle UDanzmannGameplayMessagesGameInstanceSubsystem::RegisterListener(const FGameplayTag Channel, const TSharedRef<FDanzmannGameplayMessageBuffer>& Buffer, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria, const int32 LocalPlayerIndex)
+{
+	const UScriptStruct* GameplayMessageStructType = Buffer->GetGameplayMessageStructType();
+	if (GameplayMessageStructType == nullptr)
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Error, TEXT("[%hs] Failed to register buffer with an invalid Gameplay Message struct type on channel %s."), __FUNCTION__, *Channel.ToString());
+		return FDanzmannGameplayMessagesListenerHandle();
+	}
+
+	FDanzmannGameplayMessagesListenerData ListenerData;
+	ListenerData.Buffer = Buffer;
+
+	return RegisterListener_Internal(Channel, MoveTemp(ListenerData), GameplayMessageStructType, ChannelMatchCriteria, EDanzmannGameplayMessagesDeliveryTickGroup::Immediate, LocalPlayerIndex);
+}
+
+FDanzmannGameplayMessagesListenerHandle UDanzmannGameplayMessagesGameInstanceSubsystem::RegisterListener(const FGameplayTag Channel, const FScriptDelegate& Delegate, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria, const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup, const int32 LocalPlayerIndex)
+{
+	return RegisterScriptListener_Internal(Channel, Delegate.GetUObject(), Delegate.GetFunctionName(), ChannelMatchCriteria, DeliveryTickGroup, LocalPlayerIndex);
+}
+
+FDanzmannGameplayMessagesListenerHandle UDanzmannGameplayMessagesGameInstanceSubsystem::BP_RegisterListener(const FGameplayTag Channel, UObject* Listener, const FName FunctionName, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria, const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup, const int32 LocalPlayerIndex)
+{
+	return RegisterScriptListener_Internal(Channel, Listener, FunctionName, ChannelMatchCriteria, DeliveryTickGroup, LocalPlayerIndex);
+}
+
+FDanzmannGameplayMessagesListenerHandle UDanzmannGameplayMessagesGameInstanceSubsystem::RegisterScriptListener_Internal(const FGameplayTag Channel, UObject* Object, const FName FunctionName, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria, const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup, const int32 LocalPlayerIndex)
+{
+	// Function and its parameters are validated here, once, so nothing but a copy into the parameter frame happens per delivery
+	TSharedPtr<FDanzmannGameplayMessagesScriptListener> ScriptListener = FDanzmannGameplayMessagesScriptListener::Create(Object, FunctionName);
+	if (!ScriptListener.IsValid())
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Error, TEXT("[%hs] Failed to register function %s of %s on channel %s."), __FUNCTION__, *FunctionName.ToString(), *GetPathNameSafe(Object), *Channel.ToString());
+		return FDanzmannGameplayMessagesListenerHandle();
+	}
+
+	const UScriptStruct* GameplayMessageStructType = ScriptListener->GetGameplayMessageStructType();
+
+	FDanzmannGameplayMessagesListenerData ListenerData;
+	ListenerData.Object = Object;
+	ListenerData.ScriptListener = MoveTemp(ScriptListener);
+
+	return RegisterListener_Internal(Channel, MoveTemp(ListenerData), GameplayMessageStructType, ChannelMatchCriteria, DeliveryTickGroup, LocalPlayerIndex);
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::InvokeListener_Internal(const FDanzmannGameplayMessagesListenerData& Listener, const FGameplayTag Channel, const UScriptStruct* GameplayMessageStructType, const void* GameplayMessagePayload)
+{
+	if (Listener.Thunk != nullptr)
+	{
+		if (Listener.Callable.IsValid())
+		{
+			Listener.Thunk(EDanzmannGameplayMessagesThunkOperation::Invoke, Listener.Callable->Callable, nullptr, Channel, GameplayMessagePayload);
+		}
+		// The object registering the member function is checked if it still exists before invoking it
+		else if (UObject* Object = Listener.Object.Get())
+		{
+			Listener.Thunk(EDanzmannGameplayMessagesThunkOperation::Invoke, Listener.MemberFunction, Object, Channel, GameplayMessagePayload);
+		}
+	}
+	else if (Listener.ScriptListener.IsValid())
+	{
+		Listener.ScriptListener->Invoke(Channel, GameplayMessagePayload);
+	}
+	else if (Listener.Buffer.IsValid())
+	{
+		Listener.Buffer->Add(Channel, GameplayMessagePayload);
+	}
+	else if (Listener.Callback)
+	{
+		Listener.Callback(Channel, GameplayMessageStructType, GameplayMessagePayload);
+	}
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::UnregisterListener(const FDanzmannGameplayMessagesListenerHandle Handle)
+{
+	if (Handle.IsValid())
+	{
+		UnregisterListener_Internal(Handle.Channel, Handle.Id);
+	}
+	else
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Warning, TEXT("[%hs] Trying to unregister an invalid handle."), __FUNCTION__);
+	}
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::BP_UnregisterListener(const FDanzmannGameplayMessagesListenerHandle Handle)
+{
+	UnregisterListener(Handle);
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::UnregisterListener_Internal(const FGameplayTag Channel, int32 HandleId)
+{
+	if (FDanzmannChannelListenerList* ListenersList = ListenerMap.Find(Channel))
+	{
+		const int32 MatchIndex = ListenersList->Listeners.IndexOfByPredicate(
+			[Id = HandleId]
+			(const FDanzmannGameplayMessagesListenerData& Other)
+			{
+				return Other.HandleId == Id;
+			}
+		);
+		
+		if (MatchIndex != INDEX_NONE)
+		{
+			const FObjectKey OwnerKey = ListenersList->Listeners[MatchIndex].OwnerKey;
+			if (OwnerKey != FObjectKey())
+			{
+				RemoveOwnerListener_Internal(OwnerKey, Channel, HandleId);
+			}
+
+			ListenersList->Listeners.RemoveAtSwap(MatchIndex);
+			ListenersList->PackedTypeKeys.RemoveAtSwap(MatchIndex);
+			ListenersList->PackedStructTypes.RemoveAtSwap(MatchIndex);
+			ListenersList->PackedFlags.RemoveAtSwap(MatchIndex);
+			UpdateDispatchMode(*ListenersList);
+		}
+
+		if (ListenersList->Listeners.Num() == 0)
+		{
+			// Keep channel stats around for the channel profile
+			ChannelProfile.Add(Channel, ListenersList->Stats);
+			ListenerMap.Remove(Channel);
+			++ListenerMapGeneration;
+		}
+	}
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::UnregisterAllListenersForOwner(const UObject* Owner)
+{
+	if (Owner == nullptr)
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Warning, TEXT("[%hs] Trying to unregister listeners of an invalid owner."), __FUNCTION__);
+		return;
+	}
+
+	UnregisterAllListenersForOwner_Internal(FObjectKey(Owner));
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::BP_UnregisterAllListenersForOwner(const UObject* Owner)
+{
+	UnregisterAllListenersForOwner(Owner);
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::BroadcastRetainedGameplayMessage(const FGameplayTag Channel, const FConstStructView GameplayMessage)
+{
+	if (!GameplayMessage.IsValid())
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Error, TEXT("[%hs] Trying to retain an empty struct view on channel %s."), __FUNCTION__, *Channel.ToString());
+		return;
+	}
+
+	// Retained copy is replaced before broadcasting, so listeners reading it back see the new value. Broadcast uses the caller's memory, which listeners can't replace
+	RetainedGameplayMessages.FindOrAdd(Channel).InitializeAs(GameplayMessage.GetScriptStruct(), GameplayMessage.GetMemory());
+	BroadcastGameplayMessage_Internal(Channel, GameplayMessage.GetScriptStruct(), GameplayMessage.GetMemory());
+}
+
+FConstStructView UDanzmannGameplayMessagesGameInstanceSubsystem::GetRetainedGameplayMessage(const FGameplayTag Channel) const
+{
+	const FInstancedStruct* RetainedGameplayMessage = RetainedGameplayMessages.Find(Channel);
+	return RetainedGameplayMessage != nullptr ? FConstStructView(*RetainedGameplayMessage) : FConstStructView();
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::ClearRetainedGameplayMessage(const FGameplayTag Channel)
+{
+	RetainedGameplayMessages.Remove(Channel);
+}
+
+int32 UDanzmannGameplayMessagesGameInstanceSubsystem::UnregisterAllListenersForOwner_Internal(const FObjectKey OwnerKey)
+{
+	return UnregisterAllListenersForOwners_Internal(MakeArrayView(&OwnerKey, 1));
+}
+
+int32 UDanzmannGameplayMessagesGameInstanceSubsystem::UnregisterAllListenersForOwners_Internal(const TConstArrayView<FObjectKey> OwnerKeys)
+{
+	// Index entries are taken out first, so removing each listener doesn't have to update them
+	TSet<FObjectKey> RemovedOwnerKeys;
+	TSet<FGameplayTag> Channels;
+	RemovedOwnerKeys.Reserve(OwnerKeys.Num());
+	for (const FObjectKey& OwnerKey : OwnerKeys)
+	{
+		TArray<FDanzmannGameplayMessagesListenerHandle, TInlineAllocator<4>> Handles;
+		if (OwnerListenerMap.RemoveAndCopyValue(OwnerKey, Handles))
+		{
+			RemovedOwnerKeys.Add(OwnerKey);
+			for (const FDanzmannGameplayMessagesListenerHandle& Handle : Handles)
+			{
+				Channels.Add(Handle.Channel);
+			}
+		}
+	}
+
+	// Compact each channel list once, keeping packed metadata in sync
+	int32 NumRemovedListeners = 0;
+	for (const FGameplayTag Channel : Channels)
+	{
+		FDanzmannChannelListenerList* ListenersList = ListenerMap.Find(Channel);
+		if (ListenersList == nullptr)
+		{
+			continue;
+		}
+
+		const int32 NumListeners = ListenersList->Listeners.Num();
+		int32 NumKeptListeners = 0;
+		for (int32 Index = 0; Index < NumListeners; ++Index)
+		{
+			if (RemovedOwnerKeys.Contains(ListenersList->Listeners[Index].OwnerKey))
+			{
+				continue;
+			}
+
+			if (NumKeptListeners != Index)
+			{
+				ListenersList->Listeners[NumKeptListeners] = MoveTemp(ListenersList->Listeners[Index]);
+				ListenersList->PackedTypeKeys[NumKeptListeners] = ListenersList->PackedTypeKeys[Index];
+				ListenersList->PackedStructTypes[NumKeptListeners] = ListenersList->PackedStructTypes[Index];
+				ListenersList->PackedFlags[NumKeptListeners] = ListenersList->PackedFlags[Index];
+			}
+
+			++NumKeptListeners;
+		}
+
+		NumRemovedListeners += NumListeners - NumKeptListeners;
+		ListenersList->Listeners.SetNum(NumKeptListeners, EAllowShrinking::No);
+		ListenersList->PackedTypeKeys.SetNum(NumKeptListeners, EAllowShrinking::No);
+		ListenersList->PackedStructTypes.SetNum(NumKeptListeners, EAllowShrinking::No);
+		ListenersList->PackedFlags.SetNum(NumKeptListeners, EAllowShrinking::No);
+
+		if (NumKeptListeners == 0)
+		{
+			// Keep channel stats around for the channel profile
+			ChannelProfile.Add(Channel, ListenersList->Stats);
+			ListenerMap.Remove(Channel);
+			++ListenerMapGeneration;
+		}
+		else
+		{
+			UpdateDispatchMode(*ListenersList);
+		}
+	}
+
+	return NumRemovedListeners;
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::HandlePostGarbageCollect()
+{
+	// Gather destroyed owners first, removing their listeners updates the owner index
+	TArray<FObjectKey, TInlineAllocator<16>> DestroyedOwners;
+	for (const TPair<FObjectKey, TArray<FDanzmannGameplayMessagesListenerHandle, TInlineAllocator<4>>>& Pair : OwnerListenerMap)
+	{
+		if (Pair.Key.ResolveObjectPtr() == nullptr)
+		{
+			DestroyedOwners.Add(Pair.Key);
+		}
+	}
+
+	// Owners of a whole world may go away at once (e.g., on travel), remove their listeners in one batch
+	const int32 NumRemovedListeners = DestroyedOwners.Num() > 0 ? UnregisterAllListenersForOwners_Internal(DestroyedOwners) : 0;
+
+	if (NumRemovedListeners > 0)
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Verbose, TEXT("[%hs] Removed %d listeners of %d destroyed owners."), __FUNCTION__, NumRemovedListeners, DestroyedOwners.Num());
+	}
+
+	// Packed struct types are compared as plain pointers, listeners of a garbage collected struct type have to go before another one can take its address
+	if (bHasCollectableListenerTypes)
+	{
+		TArray<FDanzmannGameplayMessagesListenerHandle, TInlineAllocator<16>> InvalidTypeHandles;
+		for (const TPair<FGameplayTag, FDanzmannChannelListenerList>& Pair : ListenerMap)
+		{
+			for (const FDanzmannGameplayMessagesListenerData& Listener : Pair.Value.Listeners)
+			{
+				if (Listener.bHasValidType && !Listener.GameplayMessageStructType.IsValid())
+				{
+					InvalidTypeHandles.Emplace(Pair.Key, Listener.HandleId);
+				}
+			}
+		}
+
+		for (const FDanzmannGameplayMessagesListenerHandle& Handle : InvalidTypeHandles)
+		{
+			UnregisterListener_Internal(Handle.Channel, Handle.Id);
+		}
+
+		if (InvalidTypeHandles.Num() > 0)
+		{
+			UE_LOG(LogDanzmannGameplayMessages, Warning, TEXT("[%hs] Removed %d listeners whose Gameplay Message struct type has gone invalid."), __FUNCTION__, InvalidTypeHandles.Num());
+		}
+	}
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::RemoveOwnerListener_Internal(const FObjectKey OwnerKey, const FGameplayTag Channel, const int32 HandleId)
+{
+	if (TArray<FDanzmannGameplayMessagesListenerHandle, TInlineAllocator<4>>* Handles = OwnerListenerMap.Find(OwnerKey))
+	{
+		Handles->RemoveAllSwap(
+			[Channel, HandleId]
+			(const FDanzmannGameplayMessagesListenerHandle& Other)
+			{
+				return (Other.Id == HandleId) && (Other.Channel == Channel);
+			}
+		);
+
+		if (Handles->Num() == 0)
+		{
+			OwnerListenerMap.Remove(OwnerKey);
+		}
+	}
+}
+
+const FDanzmannGameplayMessagesListenerData* UDanzmannGameplayMessagesGameInstanceSubsystem::FindListener_Internal(const FGameplayTag Channel, const int32 HandleId) const
+{
+	if (const FDanzmannChannelListenerList* ListenersList = ListenerMap.Find(Channel))
+	{
+		return ListenersList->Listeners.FindByPredicate(
+			[Id = HandleId]
+			(const FDanzmannGameplayMessagesListenerData& Other)
+			{
+				return Other.HandleId == Id;
+			}
+		);
+	}
+
+	return nullptr;
+}
+
+const FDanzmannGameplayMessagePayloadHandle& UDanzmannGameplayMessagesGameInstanceSubsystem::FDanzmannGameplayMessageBroadcastContext::GetOrCreateSharedPayload()
+{
+	if (!SharedPayload.IsValid())
+	{
+		// Moving an instanced struct keeps its memory where it is, so GameplayMessagePayload stays valid for synchronous listeners
+		SharedPayload = FDanzmannGameplayMessagePayload::Create(GameplayMessageStructType, GameplayMessagePayload, NativeGameplayMessageType, OwnedGameplayMessage);
+	}
+
+	return SharedPayload;
+}
+
+bool UDanzmannGameplayMessagesGameInstanceSubsystem::EnqueueDeferredGameplayMessage(const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup, FDanzmannGameplayMessageBroadcastContext& Context, const FGameplayTag ListenerChannel, const int32 ListenerHandleId)
+{
+	if (!RegisterDeliveryTickFunction(DeliveryTickGroup))
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Verbose, TEXT("[%hs] No world to tick in, delivering Gameplay Message on channel %s immediately."), __FUNCTION__, *Context.Channel.ToString());
+		return false;
+	}
+
+	FDanzmannDeferredGameplayMessageQueue& Queue = DeferredQueues[static_cast<int32>(DeliveryTickGroup)];
+	int32& QueuedIndex = Context.QueuedIndices[static_cast<int32>(DeliveryTickGroup)];
+
+	if (QueuedIndex == INDEX_NONE)
+	{
+		FDanzmannDeferredGameplayMessage& DeferredGameplayMessage = Queue.GameplayMessages.AddDefaulted_GetRef();
+		DeferredGameplayMessage.Channel = Context.Channel;
+		DeferredGameplayMessage.Payload = Context.GetOrCreateSharedPayload();
+		QueuedIndex = Queue.GameplayMessages.Num() - 1;
+	}
+
+	Queue.GameplayMessages[QueuedIndex].Listeners.Add(FDanzmannGameplayMessagesListenerHandle(ListenerChannel, ListenerHandleId));
+	return true;
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::FlushDeferredGameplayMessages(const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup)
+{
+	FDanzmannDeferredGameplayMessageQueue& Queue = DeferredQueues[static_cast<int32>(DeliveryTickGroup)];
+
+	// Take ownership of the queue so Gameplay Messages broadcast by listeners while flushing are delivered on the next tick
+	TArray<FDanzmannDeferredGameplayMessage> GameplayMessages = MoveTemp(Queue.GameplayMessages);
+	Queue.GameplayMessages.Reset();
+
+	// Nothing left to flush, stop ticking until something is queued again
+	if (Queue.TickFunction.IsValid() && Queue.TickFunction->IsTickFunctionRegistered())
+	{
+		Queue.TickFunction->SetTickFunctionEnable(false);
+	}
+
+	for (const FDanzmannDeferredGameplayMessage& DeferredGameplayMessage : GameplayMessages)
+	{
+		const UScriptStruct* GameplayMessageStructType = DeferredGameplayMessage.Payload->GetScriptStruct();
+		const void* GameplayMessagePayload = DeferredGameplayMessage.Payload->GetMemory();
+		const uint32 NativeGameplayMessageTypeId = DeferredGameplayMessage.Payload->GetNativeTypeId();
+
+		for (const FDanzmannGameplayMessagesListenerHandle& Handle : DeferredGameplayMessage.Listeners)
+		{
+			// Listener may have been unregistered since Gameplay Message was queued
+			if (const FDanzmannGameplayMessagesListenerData* Listener = FindListener_Internal(Handle.Channel, Handle.Id))
+			{
+				// Type is checked again before invoking, listener must never be handed a Gameplay Message of a type it doesn't expect
+				const bool bIsCompatibleType = NativeGameplayMessageTypeId != 0 ?
+					(Listener->NativeGameplayMessageTypeId == NativeGameplayMessageTypeId) :
+					((Listener->NativeGameplayMessageTypeId == 0) && (GameplayMessageStructType != nullptr) && (!Listener->bHasValidType || (Listener->GameplayMessageStructType.IsValid() && GameplayMessageStructType->IsChildOf(Listener->GameplayMessageStructType.Get()))));
+
+				if (!bIsCompatibleType)
+				{
+					UE_LOG(LogDanzmannGameplayMessages, Error, TEXT("[%hs] Gameplay Message type mismatch on channel %s while flushing deferred Gameplay Messages, listener at %s is skipped."), __FUNCTION__, *DeferredGameplayMessage.Channel.ToString(), *Handle.Channel.ToString());
+					continue;
+				}
+
+				// Copy in case there are registrations or removals while handling callback
+				const FDanzmannGameplayMessagesListenerData ListenerCopy = *Listener;
+				InvokeListener_Internal(ListenerCopy, DeferredGameplayMessage.Channel, GameplayMessageStructType, GameplayMessagePayload);
+			}
+		}
+	}
+
+	// Hand allocation back to the queue, unless listeners queued something else while flushing
+	if (Queue.GameplayMessages.Num() == 0)
+	{
+		GameplayMessages.Reset();
+		Queue.GameplayMessages = MoveTemp(GameplayMessages);
+	}
+}
+
+bool UDanzmannGameplayMessagesGameInstanceSubsystem::RegisterDeliveryTickFunction(const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup)
+{
+	const UGameInstance* GameInstance = GetGameInstance();
+	UWorld* World = bIsWorldRouter ? RoutedWorld.Get() : (IsValid(GameInstance) ? GameInstance->GetWorld() : nullptr);
+	if (!IsValid(World) || (World->PersistentLevel == nullptr) || World->bIsTearingDown)
+	{
+		return false;
+	}
+
+	// Game Instance moved to another world, tick functions must follow it
+	if (DeliveryTickWorld.IsValid() && (DeliveryTickWorld.Get() != World))
+	{
+		UnregisterDeliveryTickFunctions();
+	}
+
+	FDanzmannDeferredGameplayMessageQueue& Queue = DeferredQueues[static_cast<int32>(DeliveryTickGroup)];
+	if (!Queue.TickFunction.IsValid())
+	{
+		Queue.TickFunction = MakeUnique<FDanzmannGameplayMessagesTickFunction>();
+		Queue.TickFunction->Subsystem = this;
+		Queue.TickFunction->DeliveryTickGroup = DeliveryTickGroup;
+		Queue.TickFunction->bCanEverTick = true;
+		Queue.TickFunction->bStartWithTickEnabled = false;
+		Queue.TickFunction->bTickEvenWhenPaused = true;
+		Queue.TickFunction->bAllowTickOnDedicatedServer = true;
+		Queue.TickFunction->TickGroup = FDanzmannGameplayMessagesTickFunction::ToTickingGroup(DeliveryTickGroup);
+		Queue.TickFunction->EndTickGroup = Queue.TickFunction->TickGroup;
+	}
+
+	if (!Queue.TickFunction->IsTickFunctionRegistered())
+	{
+		Queue.TickFunction->RegisterTickFunction(World->PersistentLevel);
+		DeliveryTickWorld = World;
+
+		if (!WorldCleanupHandle.IsValid())
+		{
+			WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &ThisClass::HandleWorldCleanup);
+		}
+	}
+
+	if (!Queue.TickFunction->IsTickFunctionEnabled())
+	{
+		Queue.TickFunction->SetTickFunctionEnable(true);
+	}
+
+	return true;
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::UnregisterDeliveryTickFunctions()
+{
+	for (FDanzmannDeferredGameplayMessageQueue& Queue : DeferredQueues)
+	{
+		if (Queue.TickFunction.IsValid() && Queue.TickFunction->IsTickFunctionRegistered())
+		{
+			Queue.TickFunction->UnRegisterTickFunction();
+		}
+	}
+
+	DeliveryTickWorld.Reset();
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	if ((World == nullptr) || (World != DeliveryTickWorld.Get()))
+	{
+		return;
+	}
+
+	UnregisterDeliveryTickFunctions();
+
+	// Deliver anything still queued before the world goes away, so Gameplay Messages are never silently dropped
+	for (int32 Index = 0; Index < NumDeliveryTickGroups; ++Index)
+	{
+		if (DeferredQueues[Index].GameplayMessages.Num() > 0)
+		{
+			FlushDeferredGameplayMessages(static_cast<EDanzmannGameplayMessagesDeliveryTickGroup>(Index));
+		}
+	}
+}
+
+UDanzmannGameplayMessagesGameInstanceSubsystem::FDanzmannChannelListenerList* UDanzmannGameplayMessagesGameInstanceSubsystem::FindDeclaredChannelList_Internal(const FDanzmannGameplayMessageChannel& Channel, const int32 Level)
+{
+	const int32 ChannelIndex = Channel.GetIndex();
+	if (!DeclaredChannelCaches.IsValidIndex(ChannelIndex))
+	{
+		DeclaredChannelCaches.SetNum(FDanzmannGameplayMessageChannel::GetNumIndices());
+	}
+
+	// Listener lists only move when ListenerMap gains or loses a channel, find them again only then
+	FDanzmannDeclaredChannelCache& Cache = DeclaredChannelCaches[ChannelIndex];
+	if (Cache.ListenerMapGeneration != ListenerMapGeneration)
+	{
+		Cache.ListenersLists.Reset();
+		for (const FGameplayTag Tag : Channel.GetHierarchy())
+		{
+			Cache.ListenersLists.Add(ListenerMap.Find(Tag));
+		}
+
+		Cache.ListenerMapGeneration = ListenerMapGeneration;
+	}
+
+	return Cache.ListenersLists.IsValidIndex(Level) ? Cache.ListenersLists[Level] : nullptr;
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::UpdateDispatchMode(FDanzmannChannelListenerList& ListenersList)
+{
+	ListenersList.DispatchMode = (ListenersList.bIsHot && (ListenersList.Listeners.Num() == 1)) ? EDanzmannChannelDispatchMode::SingleListener : EDanzmannChannelDispatchMode::Filtered;
+}
+
+void UDanzmannGameplayMessagesGameInstanceSubsystem::RecordChannelBroadcast(FDanzmannChannelListenerList& ListenersList, const int32 Fanout)
+{
+	FDanzmannChannelStats& Stats = ListenersList.Stats;
+	Stats.NumBroadcasts++;
+	Stats.TotalFanout += Fanout;
+	Stats.WindowNumBroadcasts++;
+
+	const uint64 ElapsedFrames = GFrameCounter - Stats.WindowStartFrame;
+	if (ElapsedFrames < HotChannelWindowFrames)
+	{
+		return;
+	}
+
+	// Window only ends on a broadcast, so it may have lasted far longer than HotChannelWindowFrames (e.g., a handful of broadcasts spread over thousands of frames)
+	const float WindowBroadcastsPerFrame = static_cast<float>(Stats.WindowNumBroadcasts) / static_cast<float>(ElapsedFrames);
+	Stats.RecentBroadcastsPerFrame = FMath::Lerp(Stats.RecentBroadcastsPerFrame, WindowBroadcastsPerFrame, HotChannelRateSmoothing);
+	const bool bIsHot = Stats.RecentBroadcastsPerFrame >= HotChannelBroadcastsPerFrame;
+	Stats.WindowStartFrame = GFrameCounter;
+	Stats.WindowNumBroadcasts = 0;
+
+	if (bIsHot != ListenersList.bIsHot)
+	{
+		ListenersList.bIsHot = bIsHot;
+		UpdateDispatchMode(ListenersList);
+	}
+}
+
+bool UDanzmannGameplayMessagesGameInstanceSubsystem::SaveChannelProfile(const FString& Filename) const
+{
+	// Merge stats of channels that currently have listeners with the ones that don't anymore
+	TMap<FGameplayTag, FDanzmannChannelStats> ChannelStats = ChannelProfile;
+	for (const TPair<FGameplayTag, FDanzmannChannelListenerList>& Pair : ListenerMap)
+	{
+		ChannelStats.Add(Pair.Key, Pair.Value.Stats);
+	}
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+
+	uint32 Magic = DanzmannGameplayMessages::Private::ChannelProfileMagic;
+	int32 Version = DanzmannGameplayMessages::Private::ChannelProfileVersion;
+	int32 NumChannels = ChannelStats.Num();
+	Writer << Magic << Version << NumChannels;
+
+	for (TPair<FGameplayTag, FDanzmannChannelStats>& Pair : ChannelStats)
+	{
+		FName ChannelName = Pair.Key.GetTagName();
+		Writer << ChannelName << Pair.Value.NumBroadcasts << Pair.Value.TotalFanout << Pair.Value.RecentBroadcastsPerFrame;
+	}
+
+	if (!FFileHelper::SaveArrayToFile(Data, *Filename))
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Warning, TEXT("[%hs] Failed to save channel profile to %s."), __FUNCTION__, *Filename);
+		return false;
+	}
+
+	UE_LOG(LogDanzmannGameplayMessages, Log, TEXT("[%hs] Saved profile of %d channels to %s."), __FUNCTION__, NumChannels, *Filename);
+	return true;
+}
+
+bool UDanzmannGameplayMessagesGameInstanceSubsystem::LoadChannelProfile(const FString& Filename)
+{
+	// Single read, then everything is parsed from memory
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *Filename))
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Warning, TEXT("[%hs] Failed to load channel profile from %s."), __FUNCTION__, *Filename);
+		return false;
+	}
+
+	FMemoryReader Reader(Data);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	int32 NumChannels = 0;
+	Reader << Magic << Version << NumChannels;
+
+	if ((Magic != DanzmannGameplayMessages::Private::ChannelProfileMagic) || (Version != DanzmannGameplayMessages::Private::ChannelProfileVersion) || (NumChannels < 0))
+	{
+		UE_LOG(LogDanzmannGameplayMessages, Warning, TEXT("[%hs] %s is not a valid channel profile."), __FUNCTION__, *Filename);
+		return false;
+	}
+
+	for (int32 Index = 0; (Index < NumChannels) && !Reader.IsError(); ++Index)
+	{
+		FName ChannelName;
+		FDanzmannChannelStats Stats;
+		Reader << ChannelName << Stats.NumBroadcasts << Stats.TotalFanout << Stats.RecentBroadcastsPerFrame;
+
+		// Channels may have been removed since profile was saved
+		const FGameplayTag Channel = FGameplayTag::RequestGameplayTag(ChannelName, false);
+		if (!Channel.IsValid())
+		{
+			continue;
+		}
+
+		if (FDanzmannChannelListenerList* ListenersList = ListenerMap.Find(Channel))
+		{
+			ListenersList->Stats = Stats;
+			ListenersList->Stats.WindowStartFrame = GFrameCounter;
+			ListenersList->bIsHot = Stats.RecentBroadcastsPerFrame >= HotChannelBroadcastsPerFrame;
+			UpdateDispatchMode(*ListenersList);
+		}
+		else
+		{
+			ChannelProfile.Add(Channel, Stats);
+		}
+	}
+
+	return !Reader.IsError();
+}
+
+const UDanzmannGameplayMessagesGameInstanceSubsystem::FDanzmannChannelManifest& UDanzmannGameplayMessagesGameInstanceSubsystem::GetChannelManifest()
+{
+	static const FDanzmannChannelManifest ChannelManifest = []()
+	{
+		FDanzmannChannelManifest LoadedChannelManifest;
+
+		const FString ChannelManifestPath = FDanzmannGameplayMessagesChannelManifest::GetDefaultPath();
+		if (!IFileManager::Get().FileExists(*ChannelManifestPath))
+		{
+			return LoadedChannelManifest;
+		}
+
+		FDanzmannGameplayMessagesChannelManifest Manifest;
+		if (!Manifest.Load(ChannelManifestPath))
+		{
+			return LoadedChannelManifest;
+		}
+
+		LoadedChannelManifest.Channels.Reserve(Manifest.Entries.Num());
+		for (const FDanzmannGameplayMessagesChannelManifest::FEntry& ManifestEntry : Manifest.Entries)
+		{
+			// Channels may have been removed since manifest was generated
+			const FGameplayTag Channel = FGameplayTag::RequestGameplayTag(ManifestEntry.Channel, false);
+			if (!Channel.IsValid())
+			{
+				continue;
+			}
+
+			FDanzmannChannelManifestEntry& Entry = LoadedChannelManifest.Channels.Add(Channel);
+			Entry.NumListeners = ManifestEntry.NumListeners;
+			if (!ManifestEntry.GameplayMessageStructPath.IsEmpty())
+			{
+				Entry.GameplayMessageStructType = FindObject<UScriptStruct>(nullptr, *ManifestEntry.GameplayMessageStructPath);
+				if (Entry.GameplayMessageStructType.IsValid())
+				{
+					LoadedChannelManifest.GameplayMessageStructTypes.AddUnique(Entry.GameplayMessageStructType);
+				}
+			}
+		}
+
+		UE_LOG(LogDanzmannGameplayMessages, Log, TEXT("[%hs] Loaded %d channels from %s."), __FUNCTION__, LoadedChannelManifest.Channels.Num(), *ChannelManifestPath);
+		return LoadedChannelManifest;
+	}();
+
+	return ChannelManifest;
+}
+
+FString UDanzmannGameplayMessagesGameInstanceSubsystem::GetDefaultChannelProfilePath()
+{
+	const FString ChannelProfilePath = DanzmannGameplayMessages::Private::CVarChannelProfilePath.GetValueOnGameThread();
+	return !ChannelProfilePath.IsEmpty() ? ChannelProfilePath : FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("DanzmannGameplayMessages"), TEXT("ChannelProfile.bin"));
 }
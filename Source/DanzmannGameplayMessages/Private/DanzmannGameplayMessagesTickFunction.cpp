@@ -0,0 +1,46 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesTickFunction.h"
+#include "DanzmannGameplayMessagesGameInstanceSubsystem.h"
+
+void FDanzmannGameplayMessagesTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (IsValid(Subsystem))
+	{
+		Subsystem->FlushDeferredGameplayMessages(DeliveryTickGroup);
+	}
+}
+
+FString FDanzmannGameplayMessagesTickFunction::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("DanzmannGameplayMessages[%s]"), *UEnum::GetValueAsString(DeliveryTickGroup));
+}
+
+FName FDanzmannGameplayMessagesTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("DanzmannGameplayMessages"));
+}
+
+ETickingGroup FDanzmannGameplayMessagesTickFunction::ToTickingGroup(const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup)
+{
+	switch (DeliveryTickGroup)
+	{
+		case EDanzmannGameplayMessagesDeliveryTickGroup::PrePhysics:
+			return TG_PrePhysics;
+		case EDanzmannGameplayMessagesDeliveryTickGroup::StartPhysics:
+			return TG_StartPhysics;
+		case EDanzmannGameplayMessagesDeliveryTickGroup::DuringPhysics:
+			return TG_DuringPhysics;
+		case EDanzmannGameplayMessagesDeliveryTickGroup::EndPhysics:
+			return TG_EndPhysics;
+		case EDanzmannGameplayMessagesDeliveryTickGroup::PostPhysics:
+			return TG_PostPhysics;
+		case EDanzmannGameplayMessagesDeliveryTickGroup::PostUpdateWork:
+			return TG_PostUpdateWork;
+		case EDanzmannGameplayMessagesDeliveryTickGroup::LastDemotable:
+			return TG_LastDemotable;
+		default:
+			checkNoEntry();
+			return TG_PrePhysics;
+	}
+}
@@ -0,0 +1,127 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesWorldSubsystem.h"
+#include "DanzmannGameplayMessagesGameInstanceSubsystem.h"
+#include "DanzmannGameplayMessagesSettings.h"
+#include "DanzmannLogGameplayMessages.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+bool UDanzmannGameplayMessagesWorldSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Worlds only pay for a router of their own when routing by world
+	return Super::ShouldCreateSubsystem(Outer) && GetDefault<UDanzmannGameplayMessagesSettings>()->bRouteByWorld;
+}
+
+void UDanzmannGameplayMessagesWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	SeamlessTravelTransitionHandle = FWorldDelegates::OnSeamlessTravelTransition.AddUObject(this, &ThisClass::HandleSeamlessTravelTransition);
+
+	// Router is the same class as the Game Instance one, so it keeps the exact same API. Listeners of the world traveled from are picked up as they are
+	if (!AdoptTravelingRouter())
+	{
+		Router = NewObject<UDanzmannGameplayMessagesGameInstanceSubsystem>(this);
+		Router->InitializeForWorld(&GetWorldRef());
+	}
+}
+
+void UDanzmannGameplayMessagesWorldSubsystem::Deinitialize()
+{
+	if (SeamlessTravelTransitionHandle.IsValid())
+	{
+		FWorldDelegates::OnSeamlessTravelTransition.Remove(SeamlessTravelTransitionHandle);
+		SeamlessTravelTransitionHandle.Reset();
+	}
+
+	if (Router != nullptr)
+	{
+		Router->Shutdown_Internal();
+		Router = nullptr;
+	}
+
+	Super::Deinitialize();
+}
+
+void UDanzmannGameplayMessagesWorldSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Travel may initialize the next world before the previous one hands its router over
+	AdoptTravelingRouter();
+}
+
+UDanzmannGameplayMessagesGameInstanceSubsystem* UDanzmannGameplayMessagesWorldSubsystem::GetRouter(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	const UDanzmannGameplayMessagesWorldSubsystem* WorldSubsystem = IsValid(World) ? World->GetSubsystem<UDanzmannGameplayMessagesWorldSubsystem>() : nullptr;
+	return IsValid(WorldSubsystem) ? WorldSubsystem->GetRouter() : nullptr;
+}
+
+bool UDanzmannGameplayMessagesWorldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	if (WorldType == EWorldType::EditorPreview)
+	{
+		return GetDefault<UDanzmannGameplayMessagesSettings>()->bRouteEditorPreviewWorlds;
+	}
+
+	return (WorldType == EWorldType::Game) || (WorldType == EWorldType::PIE) || (WorldType == EWorldType::GamePreview);
+}
+
+void UDanzmannGameplayMessagesWorldSubsystem::HandleSeamlessTravelTransition(UWorld* World)
+{
+	if ((World != GetWorld()) || (Router == nullptr) || !GetDefault<UDanzmannGameplayMessagesSettings>()->bPersistAcrossSeamlessTravel)
+	{
+		return;
+	}
+
+	const UGameInstance* GameInstance = World->GetGameInstance();
+	UDanzmannGameplayMessagesGameInstanceSubsystem* GameInstanceRouter = IsValid(GameInstance) ? GameInstance->GetSubsystem<UDanzmannGameplayMessagesGameInstanceSubsystem>() : nullptr;
+	if (!IsValid(GameInstanceRouter))
+	{
+		return;
+	}
+
+	// A router still waiting from a previous world (e.g., one that traveled through this transition map) takes precedence over an empty one
+	AdoptTravelingRouter();
+
+	// Router is moved out of this world as is, only listeners of objects left behind are removed later on, in a single batch once they're garbage collected
+	Router->TravelToWorld_Internal(nullptr);
+	Router->Rename(nullptr, GameInstanceRouter, REN_DontCreateRedirectors | REN_NonTransactional);
+	GameInstanceRouter->TravelingRouter = Router;
+	Router = nullptr;
+}
+
+bool UDanzmannGameplayMessagesWorldSubsystem::AdoptTravelingRouter()
+{
+	const UGameInstance* GameInstance = GetWorldRef().GetGameInstance();
+	UDanzmannGameplayMessagesGameInstanceSubsystem* GameInstanceRouter = IsValid(GameInstance) ? GameInstance->GetSubsystem<UDanzmannGameplayMessagesGameInstanceSubsystem>() : nullptr;
+	if (!IsValid(GameInstanceRouter) || (GameInstanceRouter->TravelingRouter == nullptr))
+	{
+		return false;
+	}
+
+	UDanzmannGameplayMessagesGameInstanceSubsystem* TravelingRouter = GameInstanceRouter->TravelingRouter;
+	GameInstanceRouter->TravelingRouter = nullptr;
+
+	if (Router != nullptr)
+	{
+		// Handles given out by this world router would no longer be valid, keep it and drop the traveling one
+		if (!Router->IsEmpty_Internal())
+		{
+			UE_LOG(LogDanzmannGameplayMessages, Warning, TEXT("[%hs] Router of %s already has listeners, listeners carried across seamless travel are dropped."), __FUNCTION__, *GetPathNameSafe(GetWorld()));
+			TravelingRouter->Shutdown_Internal();
+			return false;
+		}
+
+		Router->Shutdown_Internal();
+	}
+
+	Router = TravelingRouter;
+	Router->Rename(nullptr, this, REN_DontCreateRedirectors | REN_NonTransactional);
+	Router->TravelToWorld_Internal(&GetWorldRef());
+
+	return true;
+}
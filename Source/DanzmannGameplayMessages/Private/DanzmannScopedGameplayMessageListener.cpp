@@ -0,0 +1,53 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannScopedGameplayMessageListener.h"
+#include "DanzmannGameplayMessagesGameInstanceSubsystem.h"
+
+FDanzmannScopedGameplayMessageListener::FDanzmannScopedGameplayMessageListener(UDanzmannGameplayMessagesGameInstanceSubsystem* Subsystem, const FDanzmannGameplayMessagesListenerHandle Handle):
+	Subsystem(Subsystem), Handle(Handle)
+{
+}
+
+FDanzmannScopedGameplayMessageListener::FDanzmannScopedGameplayMessageListener(FDanzmannScopedGameplayMessageListener&& Other):
+	Subsystem(Other.Subsystem), Handle(Other.Release())
+{
+}
+
+FDanzmannScopedGameplayMessageListener& FDanzmannScopedGameplayMessageListener::operator=(FDanzmannScopedGameplayMessageListener&& Other)
+{
+	if (this != &Other)
+	{
+		Reset();
+		Subsystem = Other.Subsystem;
+		Handle = Other.Release();
+	}
+
+	return *this;
+}
+
+FDanzmannScopedGameplayMessageListener::~FDanzmannScopedGameplayMessageListener()
+{
+	Reset();
+}
+
+void FDanzmannScopedGameplayMessageListener::Reset()
+{
+	if (Handle.IsValid())
+	{
+		if (UDanzmannGameplayMessagesGameInstanceSubsystem* StrongSubsystem = Subsystem.Get())
+		{
+			StrongSubsystem->UnregisterListener(Handle);
+		}
+	}
+
+	Release();
+}
+
+FDanzmannGameplayMessagesListenerHandle FDanzmannScopedGameplayMessageListener::Release()
+{
+	const FDanzmannGameplayMessagesListenerHandle ReleasedHandle = Handle;
+	Handle = FDanzmannGameplayMessagesListenerHandle();
+	Subsystem = nullptr;
+
+	return ReleasedHandle;
+}
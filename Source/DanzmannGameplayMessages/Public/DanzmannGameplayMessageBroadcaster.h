@@ -0,0 +1,84 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "DanzmannGameplayMessagesGameInstanceSubsystem.h"
+
+/**
+ * Broadcasts Gameplay Messages of a single type on a single channel, through a subsystem resolved once when it's created.
+ * Meant to be kept around by code broadcasting often (e.g., as a member initialized in BeginPlay()), so no broadcast has to get the subsystem again.
+ * @tparam TGameplayMessage Gameplay Message of UScriptStrict type (USTRUCT()) or native type (DANZMANN_DECLARE_NATIVE_GAMEPLAY_MESSAGE()).
+ * @note Usage example:
+ *       PlayerDeathBroadcaster = TDanzmannGameplayMessageBroadcaster<FMyProjectGameplayMessage_PlayerDeath>(this, MyProject::GameplayTags::GameplayMessage_PlayerDeath);
+ *       PlayerDeathBroadcaster.Broadcast(PlayerDeathPayload);
+ */
+template<typename TGameplayMessage>
+class TDanzmannGameplayMessageBroadcaster
+{
+	public:
+		TDanzmannGameplayMessageBroadcaster() = default;
+
+		/**
+		 * Create a broadcaster for a channel.
+		 * @param WorldContextObject Object whose world is used to get the subsystem.
+		 * @param Channel The Gameplay Message channel to broadcast on.
+		 */
+		TDanzmannGameplayMessageBroadcaster(const UObject* WorldContextObject, const FGameplayTag Channel):
+			Subsystem(UDanzmannGameplayMessagesGameInstanceSubsystem::HasInstance(WorldContextObject) ? UDanzmannGameplayMessagesGameInstanceSubsystem::Get(WorldContextObject) : nullptr), Channel(Channel)
+		{
+		}
+
+		/**
+		 * Create a broadcaster for a channel declared in native code.
+		 * @param WorldContextObject Object whose world is used to get the subsystem.
+		 * @param Channel The Gameplay Message channel to broadcast on, defined with DANZMANN_DEFINE_GAMEPLAY_MESSAGE_CHANNEL().
+		 */
+		TDanzmannGameplayMessageBroadcaster(const UObject* WorldContextObject, const FDanzmannGameplayMessageChannel& Channel):
+			Subsystem(UDanzmannGameplayMessagesGameInstanceSubsystem::HasInstance(WorldContextObject) ? UDanzmannGameplayMessagesGameInstanceSubsystem::Get(WorldContextObject) : nullptr), DeclaredChannel(&Channel)
+		{
+		}
+
+		/**
+		 * Broadcast a Gameplay Message. Nothing is broadcast if subsystem is gone.
+		 * @param GameplayMessage The Gameplay Message to send.
+		 */
+		void Broadcast(const TGameplayMessage& GameplayMessage) const
+		{
+			if (UDanzmannGameplayMessagesGameInstanceSubsystem* StrongSubsystem = Subsystem.Get())
+			{
+				if (DeclaredChannel != nullptr)
+				{
+					StrongSubsystem->BroadcastGameplayMessage(*DeclaredChannel, GameplayMessage);
+				}
+				else
+				{
+					StrongSubsystem->BroadcastGameplayMessage(Channel, GameplayMessage);
+				}
+			}
+		}
+
+		/**
+		 * Check if broadcaster can still broadcast.
+		 * @return Whether subsystem is still around.
+		 */
+		bool IsValid() const
+		{
+			return Subsystem.IsValid();
+		}
+
+	private:
+		/**
+		 * Subsystem Gameplay Messages are broadcast through.
+		 */
+		TWeakObjectPtr<UDanzmannGameplayMessagesGameInstanceSubsystem> Subsystem = nullptr;
+
+		/**
+		 * The Gameplay Message channel to broadcast on, unless DeclaredChannel is set.
+		 */
+		FGameplayTag Channel;
+
+		/**
+		 * The declared Gameplay Message channel to broadcast on, if any.
+		 */
+		const FDanzmannGameplayMessageChannel* DeclaredChannel = nullptr;
+};
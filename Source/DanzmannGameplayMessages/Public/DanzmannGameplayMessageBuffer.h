@@ -0,0 +1,114 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+/**
+ * Contiguous buffer Gameplay Messages are copied into by buffer listeners, instead of invoking a callback per Gameplay Message.
+ * Meant for consumers processing Gameplay Messages in bulk on their own schedule (e.g., Mass processors), which read and reset it when they're done.
+ * Gameplay Messages are stored back to back as the buffer struct type: broadcasts of child struct types only keep what's part of the buffer struct type.
+ * @see UDanzmannGameplayMessagesGameInstanceSubsystem::RegisterListener().
+ */
+class DANZMANNGAMEPLAYMESSAGES_API FDanzmannGameplayMessageBuffer : public FNoncopyable
+{
+	public:
+		/**
+		 * Create an empty buffer.
+		 * @param InGameplayMessageStructType Gameplay Message struct type stored in buffer.
+		 */
+		explicit FDanzmannGameplayMessageBuffer(const UScriptStruct* InGameplayMessageStructType);
+
+		~FDanzmannGameplayMessageBuffer();
+
+		/**
+		 * Copy a Gameplay Message at the end of the buffer.
+		 * @param Channel Channel Gameplay Message was broadcast on.
+		 * @param GameplayMessagePayload Gameplay Message content, of buffer struct type or a child of it.
+		 */
+		void Add(const FGameplayTag Channel, const void* GameplayMessagePayload);
+
+		/**
+		 * Destroy every Gameplay Message in buffer, keeping its memory around for the next ones.
+		 */
+		void Reset();
+
+		/**
+		 * Get number of Gameplay Messages in buffer.
+		 * @return Number of Gameplay Messages.
+		 */
+		int32 Num() const
+		{
+			return NumGameplayMessages;
+		}
+
+		/**
+		 * Get Gameplay Message struct type stored in buffer.
+		 * @return Gameplay Message struct type, nullptr if it's gone.
+		 */
+		const UScriptStruct* GetGameplayMessageStructType() const
+		{
+			return GameplayMessageStructType.Get();
+		}
+
+		/**
+		 * Get channel a Gameplay Message was broadcast on.
+		 * @param Index Gameplay Message index.
+		 * @return Channel.
+		 */
+		FGameplayTag GetChannel(const int32 Index) const
+		{
+			return Channels[Index];
+		}
+
+		/**
+		 * Get content of a Gameplay Message.
+		 * @param Index Gameplay Message index.
+		 * @return Gameplay Message content.
+		 */
+		const uint8* GetGameplayMessage(const int32 Index) const
+		{
+			check((Index >= 0) && (Index < NumGameplayMessages));
+			return Memory.GetData() + (Index * Stride);
+		}
+
+		/**
+		 * Get a Gameplay Message as its type.
+		 * @tparam TGameplayMessage Buffer struct type, or one of its parents.
+		 * @param Index Gameplay Message index.
+		 * @return Gameplay Message.
+		 */
+		template<typename TGameplayMessage>
+		const TGameplayMessage& Get(const int32 Index) const
+		{
+			checkSlow(GameplayMessageStructType.IsValid() && GameplayMessageStructType->IsChildOf(TBaseStructure<TGameplayMessage>::Get()));
+			return *reinterpret_cast<const TGameplayMessage*>(GetGameplayMessage(Index));
+		}
+
+	private:
+		/**
+		 * Gameplay Message struct type stored in buffer.
+		 */
+		TWeakObjectPtr<const UScriptStruct> GameplayMessageStructType = nullptr;
+
+		/**
+		 * Distance between two Gameplay Messages in buffer: struct size rounded up to its alignment.
+		 */
+		int32 Stride = 0;
+
+		/**
+		 * Number of Gameplay Messages in buffer.
+		 */
+		int32 NumGameplayMessages = 0;
+
+		/**
+		 * Gameplay Messages, back to back. Relocated bitwise when growing, like any other engine container.
+		 */
+		TArray<uint8, TAlignedHeapAllocator<16>> Memory;
+
+		/**
+		 * Channel each Gameplay Message was broadcast on.
+		 */
+		TArray<FGameplayTag> Channels;
+};
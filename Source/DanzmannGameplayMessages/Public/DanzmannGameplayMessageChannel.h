@@ -0,0 +1,156 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "DanzmannNativeGameplayMessage.h"
+#include "GameplayTagContainer.h"
+
+/**
+ * Gameplay Message channel declared in native code, with a name hashed at compile time.
+ * Every declared channel is resolved once, as soon as native Gameplay Tags are done being added: its Gameplay Tag,
+ * the tags of its parents and a dense index shared by every declaration of the same channel. Broadcasting to it
+ * then needs neither a Gameplay Tag name lookup nor a walk up the Gameplay Tag hierarchy.
+ * @see DANZMANN_DEFINE_GAMEPLAY_MESSAGE_CHANNEL().
+ * @note Channels can only be used from the game thread.
+ */
+class DANZMANNGAMEPLAYMESSAGES_API FDanzmannGameplayMessageChannel : public FNoncopyable
+{
+	public:
+		/**
+		 * Declare a channel. Only meant to be used by DANZMANN_DEFINE_GAMEPLAY_MESSAGE_CHANNEL().
+		 * @param TagName Gameplay Tag name of channel.
+		 * @param Hash Gameplay Tag name hash, computed at compile time.
+		 */
+		FDanzmannGameplayMessageChannel(const TCHAR* TagName, const uint32 Hash);
+
+		~FDanzmannGameplayMessageChannel();
+
+		/**
+		 * Get channel Gameplay Tag.
+		 * @return Channel Gameplay Tag, invalid if it doesn't exist.
+		 */
+		FGameplayTag GetTag() const
+		{
+			Resolve();
+			return Hierarchy.Num() > 0 ? Hierarchy[0] : FGameplayTag();
+		}
+
+		/**
+		 * Get channel Gameplay Tag followed by the tags of all its parents, from closest to farthest.
+		 * @return Channel Gameplay Tag hierarchy.
+		 */
+		TConstArrayView<FGameplayTag> GetHierarchy() const
+		{
+			Resolve();
+			return Hierarchy;
+		}
+
+		/**
+		 * Get dense index of channel, shared by every declaration of the same channel.
+		 * @return Index of channel, in [0, GetNumIndices()).
+		 */
+		int32 GetIndex() const
+		{
+			Resolve();
+			return Index;
+		}
+
+		/**
+		 * Get compile-time hash of channel Gameplay Tag name.
+		 * @return Channel name hash.
+		 */
+		uint32 GetHash() const
+		{
+			return Hash;
+		}
+
+		operator FGameplayTag() const
+		{
+			return GetTag();
+		}
+
+		/**
+		 * Get number of dense indices given to declared channels so far.
+		 * @return Number of indices.
+		 */
+		static int32 GetNumIndices();
+
+		/**
+		 * Resolve every channel declared so far. Called by the module once native Gameplay Tags are done being added.
+		 */
+		static void ResolveAll();
+
+	private:
+		/**
+		 * Resolve channel Gameplay Tag hierarchy and index, if not done yet.
+		 */
+		void Resolve() const
+		{
+			if (Index == INDEX_NONE)
+			{
+				Resolve_Internal();
+			}
+		}
+
+		/**
+		 * Internal helper resolving channel Gameplay Tag hierarchy and index.
+		 */
+		void Resolve_Internal() const;
+
+		/**
+		 * Gameplay Tag name of channel.
+		 */
+		const TCHAR* TagName = nullptr;
+
+		/**
+		 * Compile-time hash of TagName.
+		 */
+		uint32 Hash = 0;
+
+		/**
+		 * Dense index of channel, INDEX_NONE until resolved.
+		 */
+		mutable int32 Index = INDEX_NONE;
+
+		/**
+		 * Channel Gameplay Tag followed by the tags of all its parents.
+		 */
+		mutable TArray<FGameplayTag, TInlineAllocator<4>> Hierarchy;
+
+		/**
+		 * Next declared channel, channels register themselves in an intrusive list when constructed (during static initialization).
+		 */
+		FDanzmannGameplayMessageChannel* NextChannel = nullptr;
+};
+
+namespace DanzmannGameplayMessages
+{
+	/**
+	 * Compute a channel hash from its Gameplay Tag name (FNV-1a).
+	 * @param TagName Gameplay Tag name.
+	 * @return Channel hash.
+	 */
+	constexpr uint32 HashGameplayMessageChannelName(const char* TagName)
+	{
+		return HashNativeGameplayMessageTypeName(TagName);
+	}
+}
+
+/**
+ * Declare a channel defined with DANZMANN_DEFINE_GAMEPLAY_MESSAGE_CHANNEL() in another file, usually in a header.
+ */
+#define DANZMANN_DECLARE_GAMEPLAY_MESSAGE_CHANNEL_EXTERN(ChannelName) \
+	extern const FDanzmannGameplayMessageChannel ChannelName
+
+/**
+ * Define a native Gameplay Message channel, which can be given to the subsystem wherever a channel Gameplay Tag is expected.
+ * Broadcasting to it skips Gameplay Tag name lookups and hierarchy walks, see FDanzmannGameplayMessageChannel.
+ * @note Usage example:
+ *       // MyProjectGameplayMessageChannels.h
+ *       DANZMANN_DECLARE_GAMEPLAY_MESSAGE_CHANNEL_EXTERN(Channel_PlayerDeath);
+ *
+ *       // MyProjectGameplayMessageChannels.cpp
+ *       DANZMANN_DEFINE_GAMEPLAY_MESSAGE_CHANNEL(Channel_PlayerDeath, "GameplayMessage.PlayerDeath");
+ */
+#define DANZMANN_DEFINE_GAMEPLAY_MESSAGE_CHANNEL(ChannelName, TagName) \
+	const FDanzmannGameplayMessageChannel ChannelName(TEXT(TagName), std::integral_constant<uint32, DanzmannGameplayMessages::HashGameplayMessageChannelName(TagName)>::value)
@@ -0,0 +1,54 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "StructUtils/InstancedStruct.h"
+#include "StructUtils/StructView.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+/**
+ * Binary encoding of Gameplay Messages, meant to get them out of the process (e.g., other processes, files).
+ * Each Gameplay Message is written as its channel name, its struct type path and its size-prefixed content, serialized as tagged properties
+ * with object references written as paths. Decoders can then skip Gameplay Messages they can't resolve, and content survives struct types
+ * gaining or losing properties.
+ * @note Native Gameplay Messages have no reflection data, they can't be encoded.
+ */
+class DANZMANNGAMEPLAYMESSAGES_API FDanzmannGameplayMessageCodec
+{
+	public:
+		/**
+		 * Encode a Gameplay Message at the end of an archive.
+		 * @param Writer Archive to write into, must support seeking (e.g., FMemoryWriter).
+		 * @param Channel Channel Gameplay Message was broadcast on.
+		 * @param GameplayMessage Gameplay Message.
+		 * @return Whether Gameplay Message could be encoded.
+		 */
+		static bool Encode(FArchive& Writer, const FGameplayTag Channel, const FConstStructView GameplayMessage);
+
+		/**
+		 * Encode a Gameplay Message at the end of an archive, serializing its content through an archive of the caller's own
+		 * (e.g., one writing object references from paths captured beforehand instead of resolving them).
+		 * @param Writer Archive to write into, must support seeking (e.g., FMemoryWriter).
+		 * @param ContentWriter Proxy of Writer content is serialized through, in charge of writing object references as paths.
+		 * @param Channel Channel Gameplay Message was broadcast on.
+		 * @param GameplayMessage Gameplay Message.
+		 * @return Whether Gameplay Message could be encoded.
+		 */
+		static bool Encode(FArchive& Writer, FArchive& ContentWriter, const FGameplayTag Channel, const FConstStructView GameplayMessage);
+
+		/**
+		 * Decode next Gameplay Message of an archive. Gameplay Messages that can't be resolved are skipped, so the next one can still be decoded.
+		 * @param Reader Archive to read from.
+		 * @param OutChannel Channel Gameplay Message was broadcast on.
+		 * @param OutGameplayMessage Decoded Gameplay Message.
+		 * @return Whether Gameplay Message could be decoded.
+		 */
+		bool Decode(FArchive& Reader, FGameplayTag& OutChannel, FInstancedStruct& OutGameplayMessage);
+
+	private:
+		/**
+		 * Struct types resolved so far, by path.
+		 */
+		TMap<FString, TWeakObjectPtr<const UScriptStruct>> StructTypes;
+};
@@ -0,0 +1,94 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "DanzmannNativeGameplayMessage.h"
+#include "StructUtils/InstancedStruct.h"
+#include "StructUtils/StructView.h"
+
+class FDanzmannGameplayMessagePayload;
+
+/**
+ * Shared handle to an immutable Gameplay Message copy. Thread-safe, so it can be handed over to consumers running outside of the game thread.
+ */
+using FDanzmannGameplayMessagePayloadHandle = TSharedPtr<const FDanzmannGameplayMessagePayload, ESPMode::ThreadSafe>;
+
+/**
+ * Immutable, ref-counted copy of a broadcast Gameplay Message.
+ * It's only created the first time something needs to keep a Gameplay Message past its broadcast (e.g., listeners invoked in a specific tick group)
+ * and then shared by every other consumer of that same broadcast. Listeners invoked synchronously never need one.
+ */
+class DANZMANNGAMEPLAYMESSAGES_API FDanzmannGameplayMessagePayload : public FNoncopyable
+{
+	public:
+		/**
+		 * Create a shared copy of a Gameplay Message.
+		 * @param GameplayMessageStructType The Gameplay Message struct type, nullptr if it's a native Gameplay Message.
+		 * @param GameplayMessagePayload The Gameplay Message content.
+		 * @param NativeGameplayMessageType Native Gameplay Message type, if it's a native Gameplay Message.
+		 * @param OwnedGameplayMessage Optional instanced struct holding GameplayMessagePayload, moved into the shared copy instead of copied.
+		 * @return Handle to the shared copy.
+		 */
+		static FDanzmannGameplayMessagePayloadHandle Create(const UScriptStruct* GameplayMessageStructType, const void* GameplayMessagePayload, const FDanzmannNativeGameplayMessageType* NativeGameplayMessageType = nullptr, FInstancedStruct* OwnedGameplayMessage = nullptr);
+
+		/**
+		 * Get Gameplay Message struct type.
+		 * @return Gameplay Message struct type, nullptr if it's a native Gameplay Message.
+		 */
+		const UScriptStruct* GetScriptStruct() const
+		{
+			return GameplayMessage.GetScriptStruct();
+		}
+
+		/**
+		 * Get Gameplay Message content.
+		 * @return Gameplay Message content.
+		 */
+		const void* GetMemory() const
+		{
+			return NativeGameplayMessage.Num() > 0 ? static_cast<const void*>(NativeGameplayMessage.GetData()) : static_cast<const void*>(GameplayMessage.GetMemory());
+		}
+
+		/**
+		 * Get Gameplay Message as a struct view.
+		 * @return Struct view, empty if it's a native Gameplay Message.
+		 */
+		FConstStructView GetStructView() const
+		{
+			return FConstStructView(GameplayMessage);
+		}
+
+		/**
+		 * Get native Gameplay Message type ID.
+		 * @return Native type ID, 0 if it's a UScriptStruct Gameplay Message.
+		 */
+		uint32 GetNativeTypeId() const
+		{
+			return NativeTypeId;
+		}
+
+		/**
+		 * Get native Gameplay Message size.
+		 * @return Size of native Gameplay Message, 0 if it's a UScriptStruct Gameplay Message.
+		 */
+		int32 GetNativeSize() const
+		{
+			return NativeGameplayMessage.Num();
+		}
+
+	private:
+		/**
+		 * Gameplay Message, if it's of a UScriptStruct type.
+		 */
+		FInstancedStruct GameplayMessage;
+
+		/**
+		 * Gameplay Message, if it's of a native type. Native Gameplay Messages are trivially copyable.
+		 */
+		TArray<uint8, TAlignedHeapAllocator<DanzmannGameplayMessages::MaxNativeGameplayMessageAlignment>> NativeGameplayMessage;
+
+		/**
+		 * Native Gameplay Message type ID, 0 if it's a UScriptStruct Gameplay Message.
+		 */
+		uint32 NativeTypeId = 0;
+};
@@ -16,4 +16,16 @@ class FDanzmannGameplayMessagesModule : public IModuleInterface
 		 * @see more info in IModuleInterface. 
 		 */
 		virtual void ShutdownModule() override;
+
+	private:
+		/**
+		 * Handle of world cleanup delegate, used to keep routers cached by world up to date.
+		 */
+		FDelegateHandle RouterCacheWorldCleanupHandle;
+
+		/**
+		 * Handles of crash and ensure delegates, used to dump flight recorder.
+		 */
+		FDelegateHandle FlightRecorderSystemErrorHandle;
+		FDelegateHandle FlightRecorderSystemEnsureHandle;
 };
@@ -0,0 +1,71 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Channel manifest: every channel Gameplay Messages are broadcast or listened to on, with its Gameplay Message struct type and expected number of listeners.
+ * It's generated ahead of time by the DanzmannGameplayMessagesManifest commandlet and loaded with a single read when the subsystem is initialized.
+ */
+struct DANZMANNGAMEPLAYMESSAGES_API FDanzmannGameplayMessagesChannelManifest
+{
+	/**
+	 * Struct to store what is known about a single channel.
+	 */
+	struct FEntry
+	{
+		/**
+		 * Channel Gameplay Tag name.
+		 */
+		FName Channel = NAME_None;
+
+		/**
+		 * Path of the Gameplay Message struct type used on channel, empty if unknown.
+		 */
+		FString GameplayMessageStructPath;
+
+		/**
+		 * Number of listeners registered to channel.
+		 */
+		int32 NumListeners = 0;
+
+		/**
+		 * Number of places broadcasting to channel.
+		 */
+		int32 NumBroadcasters = 0;
+	};
+
+	/**
+	 * Save channel manifest.
+	 * @param Filename File to save channel manifest to.
+	 * @return Whether channel manifest was saved.
+	 */
+	bool Save(const FString& Filename) const;
+
+	/**
+	 * Load channel manifest, replacing current entries.
+	 * @param Filename File to load channel manifest from.
+	 * @return Whether channel manifest was loaded.
+	 */
+	bool Load(const FString& Filename);
+
+	/**
+	 * Get channel manifest file generated and loaded by default.
+	 * @return Channel manifest file, under GetDefaultDirectory() in project content directory.
+	 */
+	static FString GetDefaultPath();
+
+	/**
+	 * Get directory of channel manifest file generated and loaded by default, relative to project content directory.
+	 * Loose files under content directory are only staged if their directory is in Additional Non-Asset Directories to Package
+	 * (DirectoriesToAlwaysStageAsNonUFS), which the manifest commandlet takes care of.
+	 * @return Channel manifest directory.
+	 */
+	static FString GetDefaultDirectory();
+
+	/**
+	 * Every channel in manifest.
+	 */
+	TArray<FEntry> Entries;
+};
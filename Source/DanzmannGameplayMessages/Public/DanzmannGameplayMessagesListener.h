@@ -3,9 +3,12 @@
 #pragma once
 
 #include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
 
 #include "DanzmannGameplayMessagesListener.generated.h"
 
+class FDanzmannGameplayMessageBuffer;
+
 /**
  * Enum used to set matching rule for Gameplay Message listeners.
  */
@@ -21,6 +24,37 @@ enum class EDanzmannGameplayMessagesMatchCriteria : uint8
     PartialMatch
 };
 
+/**
+ * Enum used to set when a Gameplay Message listener is invoked relative to the world tick.
+ */
+UENUM(BlueprintType)
+enum class EDanzmannGameplayMessagesDeliveryTickGroup : uint8
+{
+    // Listener is invoked synchronously, from within the broadcast call
+    Immediate,
+
+    // Listener is invoked when the world reaches TG_PrePhysics
+    PrePhysics,
+
+    // Listener is invoked when the world reaches TG_StartPhysics
+    StartPhysics,
+
+    // Listener is invoked when the world reaches TG_DuringPhysics
+    DuringPhysics,
+
+    // Listener is invoked when the world reaches TG_EndPhysics
+    EndPhysics,
+
+    // Listener is invoked when the world reaches TG_PostPhysics
+    PostPhysics,
+
+    // Listener is invoked when the world reaches TG_PostUpdateWork
+    PostUpdateWork,
+
+    // Listener is invoked when the world reaches TG_LastDemotable
+    LastDemotable
+};
+
 /**
  * A handle that can be used to remove a previously registered Gameplay Messages listener.
  * @see UDanzmannGameplayMessagesGameInstanceSubsystem::RegisterListener() and UDanzmannGameplayMessagesGameInstanceSubsystem::UnregisterListener().
@@ -68,6 +102,192 @@ struct DANZMANNGAMEPLAYMESSAGES_API FDanzmannGameplayMessagesListenerHandle
         int32 Id = 0;
 };
 
+/**
+ * Operation requested from a listener thunk.
+ */
+enum class EDanzmannGameplayMessagesThunkOperation : uint8
+{
+    // Invoke the callable with the given channel and Gameplay Message
+    Invoke,
+
+    // Destroy the callable, it's no longer referenced by any listener
+    Destroy
+};
+
+/**
+ * Thunk that restores the Gameplay Message type of a type-erased listener callable.
+ * A single thunk is instantiated per Gameplay Message type (and callable type), so every other part of listener registration and dispatch lives in non-template code.
+ * @param Operation Operation to perform on Callable.
+ * @param Callable Type-erased callable (e.g., a TFunction or a member function pointer).
+ * @param Object Object to call Callable on if it's a member function, nullptr otherwise.
+ * @param Channel Channel Gameplay Message was broadcast on.
+ * @param GameplayMessagePayload The Gameplay Message content.
+ */
+using FDanzmannGameplayMessagesListenerThunk = void(*)(const EDanzmannGameplayMessagesThunkOperation Operation, const void* Callable, UObject* Object, const FGameplayTag Channel, const void* GameplayMessagePayload);
+
+/**
+ * Heap-owned type-erased listener callable, shared by every copy of a listener entry and destroyed through its thunk.
+ */
+struct FDanzmannGameplayMessagesListenerCallable : public FNoncopyable
+{
+    FDanzmannGameplayMessagesListenerCallable(const void* Callable, const FDanzmannGameplayMessagesListenerThunk Thunk):
+        Callable(Callable), Thunk(Thunk)
+    {
+    }
+
+    ~FDanzmannGameplayMessagesListenerCallable()
+    {
+        Thunk(EDanzmannGameplayMessagesThunkOperation::Destroy, Callable, nullptr, FGameplayTag(), nullptr);
+    }
+
+    /**
+     * Type-erased callable.
+     */
+    const void* Callable = nullptr;
+
+    /**
+     * Thunk that knows the actual type of Callable.
+     */
+    FDanzmannGameplayMessagesListenerThunk Thunk = nullptr;
+};
+
+/**
+ * Cached call layout of a UFunction invoked as a listener through reflection (e.g., a Blueprint event or a function bound to a dynamic delegate).
+ * The function is resolved and its parameters validated once at registration. Each listener owns a parameter frame initialized once
+ * at registration as well, so delivering a Gameplay Message only has to copy channel and Gameplay Message into it.
+ */
+struct DANZMANNGAMEPLAYMESSAGES_API FDanzmannGameplayMessagesScriptListener : public FNoncopyable
+{
+    ~FDanzmannGameplayMessagesScriptListener();
+
+    /**
+     * Resolve and validate a UFunction to be invoked as a listener.
+     * The function must take exactly two parameters: a FGameplayTag channel and a Gameplay Message struct (by value or const reference).
+     * @param Object Object to invoke function on.
+     * @param FunctionName Name of the function to invoke.
+     * @return Script listener, nullptr if function couldn't be found or doesn't have the expected signature (an error is logged).
+     */
+    static TSharedPtr<FDanzmannGameplayMessagesScriptListener> Create(UObject* Object, const FName FunctionName);
+
+    /**
+     * Invoke function with the specified Gameplay Message. Does nothing if object or function have gone invalid.
+     * @param Channel Channel Gameplay Message was broadcast on.
+     * @param GameplayMessagePayload The Gameplay Message content, of GameplayMessageProperty struct type (or a child of it).
+     */
+    void Invoke(const FGameplayTag Channel, const void* GameplayMessagePayload) const;
+
+    /**
+     * Get Gameplay Message struct type expected by function.
+     * @return Gameplay Message struct type.
+     */
+    const UScriptStruct* GetGameplayMessageStructType() const;
+
+    /**
+     * Object function is invoked on.
+     */
+    TWeakObjectPtr<UObject> Object = nullptr;
+
+    /**
+     * Function invoked when a Gameplay Message is received.
+     */
+    TWeakObjectPtr<UFunction> Function = nullptr;
+
+    /**
+     * Function parameter receiving the channel.
+     */
+    const FStructProperty* ChannelProperty = nullptr;
+
+    /**
+     * Function parameter receiving the Gameplay Message.
+     */
+    const FStructProperty* GameplayMessageProperty = nullptr;
+
+    /**
+     * Size of function parameter frame.
+     */
+    int32 ParmsSize = 0;
+
+    /**
+     * Alignment of function parameter frame.
+     */
+    int32 ParmsAlignment = 0;
+
+    /**
+     * Parameter frame reused by every delivery, initialized once at registration.
+     */
+    uint8* Parms = nullptr;
+
+    /**
+     * Whether Parms is currently in use. Re-entrant deliveries (e.g., listener broadcasting to itself) fall back to a temporary frame.
+     */
+    mutable bool bIsInvoking = false;
+};
+
+namespace DanzmannGameplayMessages
+{
+    /**
+     * Biggest member function pointer that can be registered as a listener. Covers every inheritance model, including virtual inheritance on MSVC.
+     */
+    static constexpr int32 MaxMemberFunctionSize = 24;
+
+    /**
+     * Number of local players (e.g., split-screen) listeners and broadcasts can be scoped to.
+     */
+    static constexpr int32 MaxLocalPlayers = 8;
+
+    namespace Private
+    {
+        /**
+         * Listener thunk for heap-owned callables (e.g., TFunction) receiving Gameplay Messages of TGameplayMessage type.
+         */
+        template<typename TCallable, typename TGameplayMessage>
+        void CallableThunk(const EDanzmannGameplayMessagesThunkOperation Operation, const void* Callable, UObject* Object, const FGameplayTag Channel, const void* GameplayMessagePayload)
+        {
+            if (Operation == EDanzmannGameplayMessagesThunkOperation::Invoke)
+            {
+                (*static_cast<const TCallable*>(Callable))(Channel, *static_cast<const TGameplayMessage*>(GameplayMessagePayload));
+            }
+            else
+            {
+                delete static_cast<const TCallable*>(Callable);
+            }
+        }
+
+        /**
+         * Listener thunk for delegates (TDelegate) receiving Gameplay Messages of TGameplayMessage type.
+         */
+        template<typename TDelegateType, typename TGameplayMessage>
+        void DelegateThunk(const EDanzmannGameplayMessagesThunkOperation Operation, const void* Callable, UObject* Object, const FGameplayTag Channel, const void* GameplayMessagePayload)
+        {
+            if (Operation == EDanzmannGameplayMessagesThunkOperation::Invoke)
+            {
+                static_cast<const TDelegateType*>(Callable)->ExecuteIfBound(Channel, *static_cast<const TGameplayMessage*>(GameplayMessagePayload));
+            }
+            else
+            {
+                delete static_cast<const TDelegateType*>(Callable);
+            }
+        }
+
+        /**
+         * Listener thunk for member functions of TListener receiving Gameplay Messages of TGameplayMessage type.
+         */
+        template<typename TListener, typename TGameplayMessage>
+        void MemberFunctionThunk(const EDanzmannGameplayMessagesThunkOperation Operation, const void* Callable, UObject* Object, const FGameplayTag Channel, const void* GameplayMessagePayload)
+        {
+            using FMemberFunction = void(TListener::*)(const FGameplayTag, const TGameplayMessage&);
+
+            // Member function pointers are stored by value in listener entries, there is nothing to destroy
+            if (Operation == EDanzmannGameplayMessagesThunkOperation::Invoke)
+            {
+                FMemberFunction MemberFunction;
+                FMemory::Memcpy(&MemberFunction, Callable, sizeof(FMemberFunction));
+                (static_cast<TListener*>(Object)->*MemberFunction)(Channel, *static_cast<const TGameplayMessage*>(GameplayMessagePayload));
+            }
+        }
+    }
+}
+
 /** 
  * Struct to store entry information for a single registered listener.
  */
@@ -82,9 +302,44 @@ struct FDanzmannGameplayMessagesListenerData
     int32 HandleId = 0;
     
     /**
-     * Listener callback for when a Gameplay Message has been received.
+     * Listener callback for when a Gameplay Message has been received. Only used by generic listeners, typed listeners go through Thunk.
      */
     TFunction<void(FGameplayTag, const UScriptStruct*, const void*)> Callback;
+
+    /**
+     * Thunk invoking Callable or MemberFunction with the listener Gameplay Message type, nullptr if listener uses Callback.
+     */
+    FDanzmannGameplayMessagesListenerThunk Thunk = nullptr;
+
+    /**
+     * Heap-owned callable invoked through Thunk, if listener was registered with a function.
+     */
+    TSharedPtr<FDanzmannGameplayMessagesListenerCallable> Callable;
+
+    /**
+     * Object MemberFunction is called on, if listener was registered with a member function.
+     */
+    TWeakObjectPtr<UObject> Object = nullptr;
+
+    /**
+     * Key of the object owning listener (Object), used to find listener in the subsystem owner index. Stays valid after object is gone.
+     */
+    FObjectKey OwnerKey;
+
+    /**
+     * Member function pointer invoked through Thunk, stored by value.
+     */
+    alignas(void*) uint8 MemberFunction[DanzmannGameplayMessages::MaxMemberFunctionSize] = {};
+
+    /**
+     * UFunction invoked through reflection, if listener was registered with a dynamic delegate.
+     */
+    TSharedPtr<FDanzmannGameplayMessagesScriptListener> ScriptListener;
+
+    /**
+     * Buffer Gameplay Messages are copied into, if listener was registered with a buffer.
+     */
+    TSharedPtr<FDanzmannGameplayMessageBuffer> Buffer;
 	
     /**
      * Listener Gameplay Message struct type.
@@ -96,8 +351,31 @@ struct FDanzmannGameplayMessagesListenerData
      */
     bool bHasValidType = false;
 
+    /**
+     * Gameplay Message struct type of listener channel in channel manifest, if it's known to be compatible with listener type.
+     * Gameplay Messages of this type are delivered to listener without checking their type hierarchy.
+     * Plain pointer, compared on every broadcast; channel manifest types are kept referenced by the subsystem.
+     */
+    const UScriptStruct* ManifestGameplayMessageStructType = nullptr;
+
+    /**
+     * Listener native Gameplay Message type ID, 0 if listener expects a UScriptStruct type.
+     * @see DANZMANN_DECLARE_NATIVE_GAMEPLAY_MESSAGE().
+     */
+    uint32 NativeGameplayMessageTypeId = 0;
+
+    /**
+     * Listener native Gameplay Message type name, used for logging.
+     */
+    FName NativeGameplayMessageTypeName = NAME_None;
+
     /**
      * Listener Gameplay Message match criteria. 
      */
     EDanzmannGameplayMessagesMatchCriteria MatchCriteria = EDanzmannGameplayMessagesMatchCriteria::ExactMatch;
+
+    /**
+     * Tick group in which listener wants to be invoked. Anything other than Immediate is queued and flushed by the subsystem.
+     */
+    EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup = EDanzmannGameplayMessagesDeliveryTickGroup::Immediate;
 };
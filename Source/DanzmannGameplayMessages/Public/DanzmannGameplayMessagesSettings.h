@@ -0,0 +1,81 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/DeveloperSettings.h"
+#include "GameplayTagContainer.h"
+
+#include "DanzmannGameplayMessagesSettings.generated.h"
+
+/**
+ * Gameplay Messages settings, found in Project Settings > Plugins > Dancing Man Gameplay Messages.
+ * Capacity hints are reserved up front by the subsystem, so registering listeners on level load doesn't keep growing and rehashing its tables.
+ */
+UCLASS(Config = Game, DefaultConfig, DisplayName = "Dancing Man Gameplay Messages")
+class DANZMANNGAMEPLAYMESSAGES_API UDanzmannGameplayMessagesSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+	public:
+		UDanzmannGameplayMessagesSettings();
+
+		/**
+		 * Get capacity hint of a channel listener list.
+		 * @param Channel Channel listeners are registered to.
+		 * @return Expected number of listeners on Channel.
+		 */
+		int32 GetListenerCapacityHint(const FGameplayTag Channel) const;
+
+		/**
+		 * Whether each world gets its own listeners, instead of sharing the ones of its Game Instance (e.g., server-side instanced dungeons).
+		 * UDanzmannGameplayMessagesGameInstanceSubsystem::Get() then returns the router of the world of the context object.
+		 * World routers are only created with this enabled, so worlds pay nothing for them otherwise.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Routing")
+		bool bRouteByWorld = false;
+
+		/**
+		 * Whether editor preview worlds (e.g., of asset editors) get their own router too when routing by world. Off by default, so opening asset editors
+		 * doesn't create a router for each of their preview worlds.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Routing", Meta = (EditCondition = "bRouteByWorld"))
+		bool bRouteEditorPreviewWorlds = false;
+
+		/**
+		 * Whether listeners and retained Gameplay Messages survive seamless travel, so persistent systems (e.g., party, inventory UI) don't have to register
+		 * their listeners and broadcast their state again. World routers are then handed over to the next world as they are. Otherwise, retained Gameplay Messages
+		 * are cleared on seamless travel. Either way, listeners of objects left behind are removed in a single batch once they're garbage collected.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Travel")
+		bool bPersistAcrossSeamlessTravel = false;
+
+		/**
+		 * Expected number of channels with listeners at the same time.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Capacity", Meta = (ClampMin = 0))
+		int32 ExpectedNumChannels = 0;
+
+		/**
+		 * Expected number of objects owning listeners at the same time.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Capacity", Meta = (ClampMin = 0))
+		int32 ExpectedNumListenerOwners = 0;
+
+		/**
+		 * Expected number of listeners of channels not found in ListenerCapacityHints.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Capacity", Meta = (ClampMin = 0))
+		int32 DefaultListenerCapacity = 0;
+
+		/**
+		 * Expected number of listeners of specific channels.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Capacity", Meta = (ClampMin = 0))
+		TMap<FGameplayTag, int32> ListenerCapacityHints;
+
+		/**
+		 * Expected number of Gameplay Messages queued for a single delivery tick group between two flushes.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Capacity", Meta = (ClampMin = 0))
+		int32 DeferredQueueCapacity = 0;
+};
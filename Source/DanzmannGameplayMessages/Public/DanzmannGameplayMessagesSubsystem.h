@@ -2,8 +2,15 @@
 
 #pragma once
 
+#include "DanzmannGameplayMessageBuffer.h"
+#include "DanzmannGameplayMessageChannel.h"
+#include "DanzmannGameplayMessagePayload.h"
 #include "DanzmannGameplayMessagesListener.h"
+#include "DanzmannGameplayMessagesTickFunction.h"
+#include "DanzmannNativeGameplayMessage.h"
 #include "GameplayTagContainer.h"
+#include "StructUtils/InstancedStruct.h"
+#include "StructUtils/StructView.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 
 #include "DanzmannGameplayMessagesGameInstanceSubsystem.generated.h"
@@ -15,7 +22,7 @@ struct FFrame;
  * This subsystem implements a decoupled messaging framework that allows senders (event raisers) and
  * listeners to communicate without having to know about each other directly by broadcasting and
  * receiving structured messages (Gameplay Messages) on named channels -- though they must agree on the format of the
- * message (as a USTRUCT() type).
+ * message (as a USTRUCT() type, or as a plain C++ type declared with DANZMANN_DECLARE_NATIVE_GAMEPLAY_MESSAGE()).
  * Listeners can register to specific Gameplay Message types and Gameplay Tag-based channels without needing
  * direct references to the senders.
  * You can get the subsystem as the following:
@@ -23,6 +30,21 @@ struct FFrame;
  *  - GetGameInstance()->GetSubsystem<UDanzmannGameplayMessagesGameInstanceSubsystem>();
  *  - UDanzmannGameplayMessagesGameInstanceSubsystem::Get(WorldContextObject);
  *
+ * Listeners can also ask to be invoked in a specific tick group instead of synchronously from within the broadcast call
+ * (e.g., a Gameplay Message broadcast during physics can be delivered in TG_PostPhysics). Those Gameplay Messages are
+ * queued per tick group and flushed by tick functions registered by the subsystem for each tick group in use.
+ *
+ * The subsystem also gathers per-channel broadcast frequency and fanout at runtime and switches hot channels to a dispatch path specialized
+ * for their number of listeners. Those stats can be saved to a channel profile, loaded at startup to pre-specialize hot channels right away.
+ *
+ * Listeners bound to an object are removed automatically once that object is garbage collected, so forgetting to unregister
+ * them doesn't make the listener map grow over long sessions.
+ *
+ * Listeners of every world under a Game Instance share this subsystem by default. With bRouteByWorld enabled in settings, Get() returns
+ * a router owned by the world of the context object instead (see UDanzmannGameplayMessagesWorldSubsystem), with this same API.
+ * With bPersistAcrossSeamlessTravel enabled, world routers are handed over to the next world on seamless travel along with their listeners
+ * and retained Gameplay Messages.
+ *
  * Note that call order when there are multiple listeners for the same channel is
  * not guaranteed and can change over time!
  */
@@ -32,6 +54,11 @@ class DANZMANNGAMEPLAYMESSAGES_API UDanzmannGameplayMessagesGameInstanceSubsyste
 	GENERATED_BODY()
 
 	public:
+		/**
+		 * @see more info in USubsystem.
+		 */
+		virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
 		/**
 		 * @see more info in USubsystem.
 		 */
@@ -39,28 +66,125 @@ class DANZMANNGAMEPLAYMESSAGES_API UDanzmannGameplayMessagesGameInstanceSubsyste
 	
 		/**
 		 * Get a reference to Gameplay Messages Game Instance Subsystem according to the Game Instance associated with the world of the specified object.
-		 * @return A reference to Gameplay Messages Game Instance Subsystem.
+		 * @return A reference to Gameplay Messages Game Instance Subsystem, or to the router of the world of the specified object when routing by world.
 		 */
 		static UDanzmannGameplayMessagesGameInstanceSubsystem* Get(const UObject* WorldContextObject);
 
+		/**
+		 * Get a reference to Gameplay Messages Game Instance Subsystem of a world, without resolving world from a context object.
+		 * On game thread, subsystem is only resolved the first time it's needed for a world and cached until the world is cleaned up.
+		 * On other threads, it's resolved on every call.
+		 * @return A reference to Gameplay Messages Game Instance Subsystem, or to the router of World when routing by world.
+		 */
+		static UDanzmannGameplayMessagesGameInstanceSubsystem* Get(const UWorld* World);
+
+		/**
+		 * Disambiguate Get(nullptr) between the overloads above. There is no subsystem without a world, so this always fails.
+		 */
+		static UDanzmannGameplayMessagesGameInstanceSubsystem* Get(TYPE_OF_NULLPTR);
+
 		/**
 		 * Check if there is a valid instance of the Gameplay Messages Game Instance Subsystem associated with the world of the specified object.
 		 * @return Whether Gameplay Messages Game Instance Subsystem is valid or not.
 		 */
 		static bool HasInstance(const UObject* WorldContextObject);
 
+		/**
+		 * Check if there is a valid instance of the Gameplay Messages Game Instance Subsystem associated with a world, without resolving world from a context object.
+		 * Uses the same cache as Get(const UWorld*) on game thread.
+		 * @return Whether Gameplay Messages Game Instance Subsystem is valid or not.
+		 */
+		static bool HasInstance(const UWorld* World);
+
+		/**
+		 * Disambiguate HasInstance(nullptr) between the overloads above.
+		 * @return Always false, there is no subsystem without a world.
+		 */
+		static bool HasInstance(TYPE_OF_NULLPTR);
+
 		/**
 		 * Broadcast a Gameplay Message on the specified channel.
-		 * @tparam TGameplayMessage Gameplay Message of UScriptStrict type (USTRUCT()).
+		 * @tparam TGameplayMessage Gameplay Message of UScriptStrict type (USTRUCT()) or native type (DANZMANN_DECLARE_NATIVE_GAMEPLAY_MESSAGE()).
 		 * @param Channel The Gameplay Message channel to broadcast on.
 		 * @param GameplayMessage The Gameplay Message to send.
 		 * @note GameplayMessage must be the same type of UScriptStruct expected by the listeners for this channel, otherwise an error will be logged.
+		 * @note Native Gameplay Messages skip reflection and are only delivered to listeners of the exact same native type.
 		 */
 		template<typename TGameplayMessage>
 		void BroadcastGameplayMessage(const FGameplayTag Channel, const TGameplayMessage& GameplayMessage)
 		{
-			const UScriptStruct* MessageStruct = TBaseStructure<TGameplayMessage>::Get();
-			BroadcastGameplayMessage_Internal(Channel, MessageStruct, &GameplayMessage);
+			static_assert(!std::is_same_v<TGameplayMessage, FStructView>, "Convert FStructView to FConstStructView to broadcast its content.");
+
+			BroadcastGameplayMessage_Internal(Channel, GetGameplayMessageStructType<TGameplayMessage>(), &GameplayMessage, nullptr, GetNativeGameplayMessageType<TGameplayMessage>());
+		}
+
+		/**
+		 * Broadcast a Gameplay Message on a channel declared in native code, which skips Gameplay Tag name lookups and hierarchy walks.
+		 * @tparam TGameplayMessage Gameplay Message of UScriptStrict type (USTRUCT()) or native type (DANZMANN_DECLARE_NATIVE_GAMEPLAY_MESSAGE()).
+		 * @param Channel The Gameplay Message channel to broadcast on, defined with DANZMANN_DEFINE_GAMEPLAY_MESSAGE_CHANNEL().
+		 * @param GameplayMessage The Gameplay Message to send.
+		 */
+		template<typename TGameplayMessage>
+		void BroadcastGameplayMessage(const FDanzmannGameplayMessageChannel& Channel, const TGameplayMessage& GameplayMessage)
+		{
+			static_assert(!std::is_same_v<TGameplayMessage, FStructView> && !std::is_same_v<TGameplayMessage, FConstStructView> && !std::is_same_v<TGameplayMessage, FInstancedStruct>, "Use Channel.GetTag() to broadcast struct views and instanced structs.");
+
+			BroadcastGameplayMessage_Internal(Channel.GetTag(), GetGameplayMessageStructType<TGameplayMessage>(), &GameplayMessage, nullptr, GetNativeGameplayMessageType<TGameplayMessage>(), &Channel);
+		}
+
+		/**
+		 * Broadcast a Gameplay Message of any UScriptStruct type on the specified channel, without instantiating a template per type.
+		 * @param Channel The Gameplay Message channel to broadcast on.
+		 * @param GameplayMessage View of the Gameplay Message to send. Nothing is broadcast if view is empty.
+		 * @note Listeners that asked for a specific tick group receive a copy of the viewed Gameplay Message.
+		 */
+		void BroadcastGameplayMessage(const FGameplayTag Channel, const FConstStructView GameplayMessage);
+
+		/**
+		 * Broadcast a Gameplay Message held by an instanced struct on the specified channel.
+		 * @param Channel The Gameplay Message channel to broadcast on.
+		 * @param GameplayMessage The Gameplay Message to send. Nothing is broadcast if instanced struct is empty.
+		 */
+		void BroadcastGameplayMessage(const FGameplayTag Channel, const FInstancedStruct& GameplayMessage);
+
+		/**
+		 * Broadcast a Gameplay Message held by an instanced struct on the specified channel, handing over its ownership.
+		 * @param Channel The Gameplay Message channel to broadcast on.
+		 * @param GameplayMessage The Gameplay Message to send. Nothing is broadcast if instanced struct is empty.
+		 * @note If any consumer needs to keep the Gameplay Message past the broadcast, the instanced struct is moved into its shared copy instead of copied, leaving GameplayMessage empty.
+		 */
+		void BroadcastGameplayMessage(const FGameplayTag Channel, FInstancedStruct&& GameplayMessage);
+
+		/**
+		 * Broadcast a Gameplay Message on the specified channel to the listeners of a single local player (e.g., split-screen HUD), plus shared listeners.
+		 * Listeners of other local players are rejected along with type mismatches when filtering, so they cost nothing past that.
+		 * @tparam TGameplayMessage Gameplay Message of UScriptStrict type (USTRUCT()) or native type (DANZMANN_DECLARE_NATIVE_GAMEPLAY_MESSAGE()).
+		 * @param LocalPlayerIndex Index of the local player Gameplay Message is meant for, as returned by ULocalPlayer::GetLocalPlayerIndex().
+		 * @param Channel The Gameplay Message channel to broadcast on.
+		 * @param GameplayMessage The Gameplay Message to send.
+		 * @see more info in BroadcastGameplayMessage().
+		 */
+		template<typename TGameplayMessage>
+		void BroadcastGameplayMessageToLocalPlayer(const int32 LocalPlayerIndex, const FGameplayTag Channel, const TGameplayMessage& GameplayMessage)
+		{
+			static_assert(!std::is_same_v<TGameplayMessage, FStructView> && !std::is_same_v<TGameplayMessage, FConstStructView> && !std::is_same_v<TGameplayMessage, FInstancedStruct>, "Struct views and instanced structs can only be broadcast to every local player.");
+
+			BroadcastGameplayMessage_Internal(Channel, GetGameplayMessageStructType<TGameplayMessage>(), &GameplayMessage, nullptr, GetNativeGameplayMessageType<TGameplayMessage>(), nullptr, LocalPlayerIndex);
+		}
+
+		/**
+		 * Broadcast a Gameplay Message on a channel declared in native code to the listeners of a single local player, plus shared listeners.
+		 * @tparam TGameplayMessage Gameplay Message of UScriptStrict type (USTRUCT()) or native type (DANZMANN_DECLARE_NATIVE_GAMEPLAY_MESSAGE()).
+		 * @param LocalPlayerIndex Index of the local player Gameplay Message is meant for, as returned by ULocalPlayer::GetLocalPlayerIndex().
+		 * @param Channel The Gameplay Message channel to broadcast on, defined with DANZMANN_DEFINE_GAMEPLAY_MESSAGE_CHANNEL().
+		 * @param GameplayMessage The Gameplay Message to send.
+		 */
+		template<typename TGameplayMessage>
+		void BroadcastGameplayMessageToLocalPlayer(const int32 LocalPlayerIndex, const FDanzmannGameplayMessageChannel& Channel, const TGameplayMessage& GameplayMessage)
+		{
+			static_assert(!std::is_same_v<TGameplayMessage, FStructView> && !std::is_same_v<TGameplayMessage, FConstStructView> && !std::is_same_v<TGameplayMessage, FInstancedStruct>, "Struct views and instanced structs can only be broadcast to every local player.");
+
+			BroadcastGameplayMessage_Internal(Channel.GetTag(), GetGameplayMessageStructType<TGameplayMessage>(), &GameplayMessage, nullptr, GetNativeGameplayMessageType<TGameplayMessage>(), &Channel, LocalPlayerIndex);
 		}
 
 		/**
@@ -79,13 +203,26 @@ class DANZMANNGAMEPLAYMESSAGES_API UDanzmannGameplayMessagesGameInstanceSubsyste
 		 * This way we can do our own implementation of the BP VM function, allowing us to parse the function parameters and enable a wildcard node for it.
 		 */
 		DECLARE_FUNCTION(execBP_BroadcastGameplayMessage);
+
+		/**
+		 * Broadcast a Gameplay Message on the specified channel to the listeners of a single local player, plus shared listeners (BP version).
+		 * @param Channel The Gameplay Message channel to broadcast on.
+		 * @param LocalPlayerIndex Index of the local player Gameplay Message is meant for.
+		 * @param GameplayMessage The Gameplay Message to send/broadcast.
+		 * @see more info in BP_BroadcastGameplayMessage().
+		 */
+		UFUNCTION(BlueprintCallable, CustomThunk, Category = "Dancing Man|Gameplay Messages", DisplayName = "Broadcast Gameplay Message To Local Player", Meta = (CustomStructureParam = "GameplayMessage", AllowAbstract = false))
+		void BP_BroadcastGameplayMessageToLocalPlayer(const FGameplayTag Channel, const int32 LocalPlayerIndex, const int32& GameplayMessage);
+		DECLARE_FUNCTION(execBP_BroadcastGameplayMessageToLocalPlayer);
 	
 		/**
 	     * Register to receive Gameplay Messages on a specified channel and use a lambda function as callback.
-		 * @tparam TGameplayMessage Gameplay Message of UScriptStrict type (USTRUCT()).
+		 * @tparam TGameplayMessage Gameplay Message of UScriptStrict type (USTRUCT()) or native type (DANZMANN_DECLARE_NATIVE_GAMEPLAY_MESSAGE()).
 		 * @param Channel The Gameplay Message channel to listen to.
 		 * @param Callback Function to call when Gameplay Message is received.
 		 * @param ChannelMatchCriteria Callback will be triggered if any Gameplay Message is broadcast to Channel and Channel match given criteria.
+		 * @param DeliveryTickGroup Tick group in which Callback is triggered. Immediate triggers it from within the broadcast call.
+		 * @param LocalPlayerIndex Local player whose Gameplay Messages are received (e.g., split-screen HUD). Shared listeners (INDEX_NONE) receive Gameplay Messages of every local player.
 		 * @return Handle that can be used to unregister this listener -- by calling UnregisterListener() on the subsystem.
 		 * @note The provided Callback must match the exact UScriptStruct used by message broadcasters on this channel. Type mismatches will result in logged runtime warnings and Gameplay Message drops.
 		 * @note Usage example:
@@ -99,27 +236,28 @@ class DANZMANNGAMEPLAYMESSAGES_API UDanzmannGameplayMessagesGameInstanceSubsyste
 		 *       );
 		 */
 		template<typename TGameplayMessage>
-		FDanzmannGameplayMessagesListenerHandle RegisterListener(const FGameplayTag Channel, TFunction<void(const FGameplayTag, const TGameplayMessage&)>&& Callback, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria = EDanzmannGameplayMessagesMatchCriteria::ExactMatch)
+		FDanzmannGameplayMessagesListenerHandle RegisterListener(const FGameplayTag Channel, TFunction<void(const FGameplayTag, const TGameplayMessage&)>&& Callback, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria = EDanzmannGameplayMessagesMatchCriteria::ExactMatch, const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup = EDanzmannGameplayMessagesDeliveryTickGroup::Immediate, const int32 LocalPlayerIndex = INDEX_NONE)
 		{
-			auto GenericCallback =
-				[RegisteredCallback = MoveTemp(Callback)]
-				(const FGameplayTag ChannelToRegister, const UScriptStruct* GameplayMessageStructType, const void* GameplayMessagePayload)
-				{
-					RegisteredCallback(ChannelToRegister, *static_cast<const TGameplayMessage*>(GameplayMessagePayload));
-				};
+			using FCallable = TFunction<void(const FGameplayTag, const TGameplayMessage&)>;
 
-			const UScriptStruct* GameplayMessageStructType = TBaseStructure<TGameplayMessage>::Get();
-			return RegisterListener_Internal(Channel, GenericCallback, GameplayMessageStructType, ChannelMatchCriteria);
+			// Only the thunk depends on Gameplay Message type, everything else is done by non-template code
+			FDanzmannGameplayMessagesListenerData ListenerData;
+			ListenerData.Thunk = &DanzmannGameplayMessages::Private::CallableThunk<FCallable, TGameplayMessage>;
+			ListenerData.Callable = MakeShared<FDanzmannGameplayMessagesListenerCallable>(new FCallable(MoveTemp(Callback)), ListenerData.Thunk);
+
+			return RegisterListener_Internal(Channel, MoveTemp(ListenerData), GetGameplayMessageStructType<TGameplayMessage>(), ChannelMatchCriteria, DeliveryTickGroup, LocalPlayerIndex, GetNativeGameplayMessageType<TGameplayMessage>());
 		}
 
 		/**
 		 * Register to receive Gameplay Messages on a specified channel and use a specified member function as callback.
 		 * @tparam TListener Listener of UObject type.
-		 * @tparam TGameplayMessage Gameplay Message of UScriptStrict type (USTRUCT()).
+		 * @tparam TGameplayMessage Gameplay Message of UScriptStrict type (USTRUCT()) or native type (DANZMANN_DECLARE_NATIVE_GAMEPLAY_MESSAGE()).
 		 * @param Channel The Gameplay Message channel to listen to.
 		 * @param Listener The object instance to call the function on.
 		 * @param Callback Member function to call when Gameplay Message is received.
 		 * @param ChannelMatchCriteria Callback will be triggered if any Gameplay Message is broadcast to Channel and Channel match given criteria.
+		 * @param DeliveryTickGroup Tick group in which Callback is triggered. Immediate triggers it from within the broadcast call.
+		 * @param LocalPlayerIndex Local player whose Gameplay Messages are received (e.g., split-screen HUD). Shared listeners (INDEX_NONE) receive Gameplay Messages of every local player.
 		 * @return Handle that can be used to unregister this listener -- by calling UnregisterListener() on the subsystem.
 		 * @note The provided Callback must match the exact UScriptStruct used by message broadcasters on this channel. Type mismatches will result in logged runtime warnings and message drops.
 		 * @note The object registering the callback function will be checked if it still exists before triggering the callback.
@@ -131,48 +269,356 @@ class DANZMANNGAMEPLAYMESSAGES_API UDanzmannGameplayMessagesGameInstanceSubsyste
 	     *       );
 		 */
 		template<typename TListener = UObject, typename TGameplayMessage>
-		FDanzmannGameplayMessagesListenerHandle RegisterListener(const FGameplayTag Channel, TListener* Listener, void(TListener::*Callback)(const FGameplayTag, const TGameplayMessage&), const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria = EDanzmannGameplayMessagesMatchCriteria::ExactMatch)
-		{
-			TWeakObjectPtr<TListener> WeakListener = Listener;
-			
-			auto GenericCallback =
-				[WeakListener, Callback]
-				(const FGameplayTag ChannelToRegister, const TGameplayMessage& GameplayMessage)
-				{
-					if (WeakListener.IsValid())
-					{
-						TListener* StrongListener = WeakListener.Get();
-						(StrongListener->*Callback)(ChannelToRegister, GameplayMessage);
-					}
-				};
-			
-			return RegisterListener<TGameplayMessage>(Channel, GenericCallback, ChannelMatchCriteria);
+		FDanzmannGameplayMessagesListenerHandle RegisterListener(const FGameplayTag Channel, TListener* Listener, void(TListener::*Callback)(const FGameplayTag, const TGameplayMessage&), const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria = EDanzmannGameplayMessagesMatchCriteria::ExactMatch, const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup = EDanzmannGameplayMessagesDeliveryTickGroup::Immediate, const int32 LocalPlayerIndex = INDEX_NONE)
+		{
+			using FMemberFunction = void(TListener::*)(const FGameplayTag, const TGameplayMessage&);
+			static_assert(sizeof(FMemberFunction) <= DanzmannGameplayMessages::MaxMemberFunctionSize, "Member function pointer is too big to be stored in listener entry.");
+
+			// Member function pointer is stored by value and invoked through a thunk shared by every listener of the same type, no closure is allocated
+			FDanzmannGameplayMessagesListenerData ListenerData;
+			ListenerData.Thunk = &DanzmannGameplayMessages::Private::MemberFunctionThunk<TListener, TGameplayMessage>;
+			ListenerData.Object = Listener;
+			FMemory::Memcpy(ListenerData.MemberFunction, &Callback, sizeof(FMemberFunction));
+
+			return RegisterListener_Internal(Channel, MoveTemp(ListenerData), GetGameplayMessageStructType<TGameplayMessage>(), ChannelMatchCriteria, DeliveryTickGroup, LocalPlayerIndex, GetNativeGameplayMessageType<TGameplayMessage>());
+		}
+
+		/**
+		 * Register to receive Gameplay Messages on a specified channel and use a delegate as callback.
+		 * The delegate is stored as is and executed directly, without being wrapped in another callable.
+		 * @tparam TGameplayMessage Gameplay Message of UScriptStrict type (USTRUCT()) or native type (DANZMANN_DECLARE_NATIVE_GAMEPLAY_MESSAGE()).
+		 * @param Channel The Gameplay Message channel to listen to.
+		 * @param Delegate Delegate to execute when Gameplay Message is received. Nothing happens if it's unbound by then.
+		 * @param ChannelMatchCriteria Delegate will be executed if any Gameplay Message is broadcast to Channel and Channel match given criteria.
+		 * @param DeliveryTickGroup Tick group in which Delegate is executed. Immediate executes it from within the broadcast call.
+		 * @param LocalPlayerIndex Local player whose Gameplay Messages are received (e.g., split-screen HUD). Shared listeners (INDEX_NONE) receive Gameplay Messages of every local player.
+		 * @return Handle that can be used to unregister this listener -- by calling UnregisterListener() on the subsystem.
+		 */
+		template<typename TGameplayMessage>
+		FDanzmannGameplayMessagesListenerHandle RegisterListener(const FGameplayTag Channel, const TDelegate<void(FGameplayTag, const TGameplayMessage&)>& Delegate, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria = EDanzmannGameplayMessagesMatchCriteria::ExactMatch, const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup = EDanzmannGameplayMessagesDeliveryTickGroup::Immediate, const int32 LocalPlayerIndex = INDEX_NONE)
+		{
+			using FDelegate = TDelegate<void(FGameplayTag, const TGameplayMessage&)>;
+
+			FDanzmannGameplayMessagesListenerData ListenerData;
+			ListenerData.Thunk = &DanzmannGameplayMessages::Private::DelegateThunk<FDelegate, TGameplayMessage>;
+			ListenerData.Callable = MakeShared<FDanzmannGameplayMessagesListenerCallable>(new FDelegate(Delegate), ListenerData.Thunk);
+			ListenerData.Object = Delegate.GetUObject();
+
+			return RegisterListener_Internal(Channel, MoveTemp(ListenerData), GetGameplayMessageStructType<TGameplayMessage>(), ChannelMatchCriteria, DeliveryTickGroup, LocalPlayerIndex, GetNativeGameplayMessageType<TGameplayMessage>());
 		}
 
+		/**
+		 * Register to receive Gameplay Messages on a specified channel and use a dynamic delegate as callback.
+		 * The bound UFunction is resolved and validated once here, then invoked directly with a cached parameter layout on every delivery.
+		 * @param Channel The Gameplay Message channel to listen to.
+		 * @param Delegate Dynamic delegate bound to a UFunction taking a FGameplayTag channel and a Gameplay Message struct (by value or const reference).
+		 * @param ChannelMatchCriteria Delegate will be executed if any Gameplay Message is broadcast to Channel and Channel match given criteria.
+		 * @param DeliveryTickGroup Tick group in which Delegate is executed. Immediate executes it from within the broadcast call.
+		 * @param LocalPlayerIndex Local player whose Gameplay Messages are received (e.g., split-screen HUD). Shared listeners (INDEX_NONE) receive Gameplay Messages of every local player.
+		 * @return Handle that can be used to unregister this listener, invalid if bound UFunction doesn't have the expected signature.
+		 * @note Gameplay Message struct type expected by listener is the one of the UFunction second parameter.
+		 */
+		FDanzmannGameplayMessagesListenerHandle RegisterListener(const FGameplayTag Channel, const FScriptDelegate& Delegate, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria = EDanzmannGameplayMessagesMatchCriteria::ExactMatch, const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup = EDanzmannGameplayMessagesDeliveryTickGroup::Immediate, const int32 LocalPlayerIndex = INDEX_NONE);
+
+		/**
+		 * Register a Blueprint function or custom event to receive Gameplay Messages on a specified channel (BP version).
+		 * The function is resolved and validated once here and invoked with a parameter frame reused across deliveries.
+		 * @param Channel The Gameplay Message channel to listen to.
+		 * @param Listener The object to call the function on.
+		 * @param FunctionName Name of a function on Listener taking a Gameplay Tag channel and a Gameplay Message struct. Its struct type is the one expected from broadcasters.
+		 * @param ChannelMatchCriteria Function will be called if any Gameplay Message is broadcast to Channel and Channel match given criteria.
+		 * @param DeliveryTickGroup Tick group in which function is called. Immediate calls it from within the broadcast call.
+		 * @param LocalPlayerIndex Local player whose Gameplay Messages are received (e.g., split-screen HUD). Shared listeners (INDEX_NONE) receive Gameplay Messages of every local player.
+		 * @return Handle that can be used to unregister this listener, invalid if function doesn't have the expected signature.
+		 */
+		UFUNCTION(BlueprintCallable, Category = "Dancing Man|Gameplay Messages", DisplayName = "Register Gameplay Message Listener", Meta = (DefaultToSelf = "Listener", AdvancedDisplay = "ChannelMatchCriteria,DeliveryTickGroup,LocalPlayerIndex"))
+		FDanzmannGameplayMessagesListenerHandle BP_RegisterListener(const FGameplayTag Channel, UObject* Listener, const FName FunctionName, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria = EDanzmannGameplayMessagesMatchCriteria::ExactMatch, const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup = EDanzmannGameplayMessagesDeliveryTickGroup::Immediate, const int32 LocalPlayerIndex = INDEX_NONE);
+
+		/**
+		 * Register to receive Gameplay Messages on a specified channel as struct views, without instantiating a template per type.
+		 * Useful for code that handles Gameplay Messages generically (e.g., data-driven triggers).
+		 * @param Channel The Gameplay Message channel to listen to.
+		 * @param GameplayMessageStructType Gameplay Message struct type expected by listener. Gameplay Messages of any type are received if nullptr.
+		 * @param Callback Function to call when Gameplay Message is received.
+		 * @param ChannelMatchCriteria Callback will be triggered if any Gameplay Message is broadcast to Channel and Channel match given criteria.
+		 * @param DeliveryTickGroup Tick group in which Callback is triggered. Immediate triggers it from within the broadcast call.
+		 * @param LocalPlayerIndex Local player whose Gameplay Messages are received (e.g., split-screen HUD). Shared listeners (INDEX_NONE) receive Gameplay Messages of every local player.
+		 * @return Handle that can be used to unregister this listener -- by calling UnregisterListener() on the subsystem.
+		 * @note Broadcast Gameplay Messages must be of GameplayMessageStructType or a child of it, otherwise an error will be logged and Gameplay Message dropped.
+		 */
+		FDanzmannGameplayMessagesListenerHandle RegisterListener(const FGameplayTag Channel, const UScriptStruct* GameplayMessageStructType, TFunction<void(const FGameplayTag, const FConstStructView)>&& Callback, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria = EDanzmannGameplayMessagesMatchCriteria::ExactMatch, const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup = EDanzmannGameplayMessagesDeliveryTickGroup::Immediate, const int32 LocalPlayerIndex = INDEX_NONE);
+
+		/**
+		 * Register a buffer to receive Gameplay Messages on a specified channel: Gameplay Messages are copied into it back to back instead of invoking a callback for each.
+		 * Meant for consumers processing many Gameplay Messages in bulk on their own schedule (e.g., Mass processors), which read and reset buffer when they're done.
+		 * @param Channel The Gameplay Message channel to listen to.
+		 * @param Buffer Buffer to copy Gameplay Messages into. Broadcast Gameplay Messages must be of its struct type or a child of it.
+		 * @param ChannelMatchCriteria Gameplay Messages are copied if they're broadcast to Channel and Channel match given criteria.
+		 * @param LocalPlayerIndex Local player whose Gameplay Messages are received. Shared listeners (INDEX_NONE) receive Gameplay Messages of every local player.
+		 * @return Handle that can be used to unregister this listener -- by calling UnregisterListener() on the subsystem.
+		 * @note Gameplay Messages are copied into buffer from within the broadcast call, there's no delivery tick group.
+		 */
+		FDanzmannGameplayMessagesListenerHandle RegisterListener(const FGameplayTag Channel, const TSharedRef<FDanzmannGameplayMessageBuffer>& Buffer, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria = EDanzmannGameplayMessagesMatchCriteria::ExactMatch, const int32 LocalPlayerIndex = INDEX_NONE);
+
 		/**
 		 * Remove a Gameplay Message listener previously registered by RegisterListener().
 		 * @param Handle The handle returned by RegisterListener().
 		 */
 		void UnregisterListener(FDanzmannGameplayMessagesListenerHandle Handle);
 
+		/**
+		 * Remove a Gameplay Message listener previously registered by RegisterListener() (BP version).
+		 * @param Handle The handle returned by RegisterListener().
+		 */
+		UFUNCTION(BlueprintCallable, Category = "Dancing Man|Gameplay Messages", DisplayName = "Unregister Gameplay Message Listener")
+		void BP_UnregisterListener(FDanzmannGameplayMessagesListenerHandle Handle);
+
+		/**
+		 * Remove every Gameplay Message listener owned by an object: member functions, delegates and Blueprint functions bound to it.
+		 * Only listeners of that object are visited, no matter how many channels have listeners.
+		 * @param Owner The object listeners were registered with.
+		 * @note Listeners registered with a lambda function have no owner, use FDanzmannScopedGameplayMessageListener to tie them to an object lifetime.
+		 */
+		void UnregisterAllListenersForOwner(const UObject* Owner);
+
+		/**
+		 * Remove every Gameplay Message listener owned by an object (BP version).
+		 * @param Owner The object listeners were registered with.
+		 */
+		UFUNCTION(BlueprintCallable, Category = "Dancing Man|Gameplay Messages", DisplayName = "Unregister All Gameplay Message Listeners For Owner", Meta = (DefaultToSelf = "Owner"))
+		void BP_UnregisterAllListenersForOwner(const UObject* Owner);
+
+		/**
+		 * Broadcast a Gameplay Message on the specified channel and retain it as the current value of that channel, replacing the previous one.
+		 * Meant for state (e.g., party members, inventory contents) rather than events: retained Gameplay Messages can be read at any time with GetRetainedGameplayMessage(),
+		 * and are carried across seamless travel as they are when bPersistAcrossSeamlessTravel is enabled in settings, so producers don't have to broadcast them again.
+		 * @param Channel The Gameplay Message channel to broadcast on.
+		 * @param GameplayMessage View of the Gameplay Message to broadcast and retain. Nothing happens if view is empty.
+		 */
+		void BroadcastRetainedGameplayMessage(const FGameplayTag Channel, const FConstStructView GameplayMessage);
+
+		/**
+		 * Broadcast a Gameplay Message on the specified channel and retain it as the current value of that channel.
+		 * @tparam TGameplayMessage Gameplay Message of UScriptStrict type (USTRUCT()).
+		 * @see more info in BroadcastRetainedGameplayMessage().
+		 */
+		template<typename TGameplayMessage>
+		void BroadcastRetainedGameplayMessage(const FGameplayTag Channel, const TGameplayMessage& GameplayMessage)
+		{
+			static_assert(!TDanzmannNativeGameplayMessageTraits<TGameplayMessage>::bIsNative, "Only UScriptStruct Gameplay Messages can be retained.");
+			static_assert(!std::is_same_v<TGameplayMessage, FStructView> && !std::is_same_v<TGameplayMessage, FInstancedStruct>, "Convert struct views and instanced structs to FConstStructView to retain their content.");
+
+			BroadcastRetainedGameplayMessage(Channel, FConstStructView::Make(GameplayMessage));
+		}
+
+		/**
+		 * Get the Gameplay Message currently retained on the specified channel.
+		 * @param Channel The Gameplay Message channel to look up.
+		 * @return View of the retained Gameplay Message, empty if nothing is retained on Channel. Only valid until channel is retained or cleared again.
+		 */
+		FConstStructView GetRetainedGameplayMessage(const FGameplayTag Channel) const;
+
+		/**
+		 * Stop retaining the Gameplay Message of the specified channel.
+		 * @param Channel The Gameplay Message channel to clear.
+		 */
+		void ClearRetainedGameplayMessage(const FGameplayTag Channel);
+
+		/**
+		 * Save per-channel broadcast frequency and fanout gathered so far (merged with the profile loaded at startup, if any).
+		 * @param Filename File to save channel profile to.
+		 * @return Whether channel profile was saved.
+		 */
+		bool SaveChannelProfile(const FString& Filename) const;
+
+		/**
+		 * Load a channel profile previously saved by SaveChannelProfile(). Channels that were hot in that profile are specialized as soon as listeners register to them.
+		 * @param Filename File to load channel profile from.
+		 * @return Whether channel profile was loaded.
+		 */
+		bool LoadChannelProfile(const FString& Filename);
+
+		/**
+		 * Get channel profile file used by default, set by DanzmannGameplayMessages.ChannelProfile.Path. Channel profiles are only saved on demand
+		 * (DanzmannGameplayMessages.ChannelProfile.Save, or on shutdown if DanzmannGameplayMessages.ChannelProfile.SaveOnShutdown is set),
+		 * and only loaded at startup if DanzmannGameplayMessages.ChannelProfile.Path is set, so routing never depends on whichever session ran last.
+		 * @return Channel profile file.
+		 */
+		static FString GetDefaultChannelProfilePath();
+
 	private:
 		/**
+		 * Allow UDanzmannGameplayMessagesWorldSubsystem to create world-scoped routers.
+		 */
+		friend class UDanzmannGameplayMessagesWorldSubsystem;
+
+		/**
+		 * Allow FDanzmannGameplayMessagesTickFunction to flush Gameplay Messages queued for its tick group.
+		 */
+		friend struct FDanzmannGameplayMessagesTickFunction;
+
+		/**
+		 * Initialize this as the router of a single world, owned by UDanzmannGameplayMessagesWorldSubsystem instead of a Game Instance.
+		 * @param World World Gameplay Messages are routed for.
+		 */
+		void InitializeForWorld(UWorld* World);
+
+		/**
+		 * Internal helper for initializing subsystem, either as Game Instance router or as world router.
+		 */
+		void Initialize_Internal();
+
+		/**
+		 * Internal helper for shutting subsystem down, either as Game Instance router or as world router. Does nothing if not initialized.
+		 * World routers are shut down through this instead of Deinitialize(), since no subsystem collection owns them.
+		 */
+		void Shutdown_Internal();
+
+		/**
+		 * Internal helper for finding router of a world: its own if routing by world, otherwise the one of its Game Instance.
+		 * @param World World to find router of.
+		 * @return Router, nullptr if there is none.
+		 */
+		static UDanzmannGameplayMessagesGameInstanceSubsystem* FindRouter_Internal(const UWorld* World);
+
+		/**
+		 * Internal helper for resolving router of a world, bypassing cache.
+		 * @param World World to find router of.
+		 * @return Router, nullptr if there is none.
+		 */
+		static UDanzmannGameplayMessagesGameInstanceSubsystem* FindRouterUncached_Internal(const UWorld* World);
+
+		/**
+		 * Internal helper for moving a world router to another world on seamless travel, keeping its listeners and retained Gameplay Messages as they are.
+		 * Gameplay Messages queued for a tick group are delivered before leaving the current world.
+		 * @param World World Gameplay Messages are routed for from now on, nullptr while traveling.
+		 */
+		void TravelToWorld_Internal(UWorld* World);
+
+		/**
+		 * Whether this router has neither listeners nor retained Gameplay Messages.
+		 */
+		bool IsEmpty_Internal() const;
+
+		/**
+		 * Clear retained Gameplay Messages on seamless travel, unless they're meant to persist across it.
+		 * @param World World being traveled from.
+		 */
+		void HandleSeamlessTravelTransition(UWorld* World);
+
+		/**
+		 * Handle of seamless travel transition delegate, only bound by the Game Instance router.
+		 */
+		FDelegateHandle SeamlessTravelTransitionHandle;
+
+		/**
+		 * World router handed over by the world being traveled from, waiting for the next world to pick it up. Held by the Game Instance router.
+		 */
+		UPROPERTY(Transient)
+		TObjectPtr<UDanzmannGameplayMessagesGameInstanceSubsystem> TravelingRouter = nullptr;
+
+		/**
+		 * Gameplay Messages retained per channel.
+		 */
+		UPROPERTY(Transient)
+		TMap<FGameplayTag, FInstancedStruct> RetainedGameplayMessages;
+
+		/**
+		 * World Gameplay Messages are routed for, if this is a world router.
+		 */
+		TWeakObjectPtr<UWorld> RoutedWorld = nullptr;
+
+		/**
+		 * Whether this is a world router, created by UDanzmannGameplayMessagesWorldSubsystem.
+		 */
+		bool bIsWorldRouter = false;
+
+		/**
+		 * Whether this router is initialized and not shut down yet.
+		 */
+		bool bIsInitialized = false;
+
+		/**
 	     * Internal helper for broadcasting a Gameplay Message. 
 		 * @param Channel The Gameplay Message channel to broadcast on.
 		 * @param GameplayMessageStructType The Gameplay Message struct type.
 		 * @param GameplayMessagePayload The Gameplay Message content.
+		 * @param OwnedGameplayMessage Optional instanced struct holding GameplayMessagePayload that may be moved into the broadcast shared copy instead of copied.
+		 * @param NativeGameplayMessageType Native Gameplay Message type if payload is not a UScriptStruct (GameplayMessageStructType is then nullptr).
+		 * @param DeclaredChannel Channel declared in native code, if Channel is one. Its listener lists are then found through its dense index.
+		 * @param LocalPlayerIndex Local player Gameplay Message is scoped to, INDEX_NONE if it's meant for every listener.
 		 */
-		void BroadcastGameplayMessage_Internal(const FGameplayTag Channel, const UScriptStruct* GameplayMessageStructType, const void* GameplayMessagePayload);
+		void BroadcastGameplayMessage_Internal(const FGameplayTag Channel, const UScriptStruct* GameplayMessageStructType, const void* GameplayMessagePayload, FInstancedStruct* OwnedGameplayMessage = nullptr, const FDanzmannNativeGameplayMessageType* NativeGameplayMessageType = nullptr, const FDanzmannGameplayMessageChannel* DeclaredChannel = nullptr, const int32 LocalPlayerIndex = INDEX_NONE);
+
+		/**
+		 * Get the UScriptStruct of a Gameplay Message type.
+		 * @tparam TGameplayMessage Gameplay Message type.
+		 * @return Gameplay Message struct type, nullptr if it's a native Gameplay Message.
+		 */
+		template<typename TGameplayMessage>
+		static const UScriptStruct* GetGameplayMessageStructType()
+		{
+			if constexpr (TDanzmannNativeGameplayMessageTraits<TGameplayMessage>::bIsNative)
+			{
+				return nullptr;
+			}
+			else
+			{
+				return TBaseStructure<TGameplayMessage>::Get();
+			}
+		}
+
+		/**
+		 * Get the native type of a Gameplay Message type.
+		 * @tparam TGameplayMessage Gameplay Message type.
+		 * @return Native Gameplay Message type, nullptr if it's a UScriptStruct Gameplay Message.
+		 */
+		template<typename TGameplayMessage>
+		static const FDanzmannNativeGameplayMessageType* GetNativeGameplayMessageType()
+		{
+			if constexpr (TDanzmannNativeGameplayMessageTraits<TGameplayMessage>::bIsNative)
+			{
+				return &TDanzmannNativeGameplayMessageTraits<TGameplayMessage>::Type;
+			}
+			else
+			{
+				return nullptr;
+			}
+		}
 
 		/**
 		 * Internal helper for registering a Gameplay Message listener.
 		 * @param Channel Gameplay Message channel to listen.
-		 * @param Callback Function to be triggered when Gameplay Message is broadcast to.
+		 * @param ListenerData Listener entry with its callback already set (either Callback or Thunk). Remaining fields are filled in here.
 		 * @param GameplayMessageStructType Gameplay Message struct type.
 		 * @param ChannelMatchCriteria Criteria to match Channel.
+		 * @param DeliveryTickGroup Tick group in which listener is invoked.
+		 * @param LocalPlayerIndex Local player listener receives Gameplay Messages of, INDEX_NONE for every local player.
+		 * @param NativeGameplayMessageType Native Gameplay Message type expected by listener, if any (GameplayMessageStructType is then nullptr).
 		 * @return Listener handle.
 		 */
-		FDanzmannGameplayMessagesListenerHandle RegisterListener_Internal(const FGameplayTag Channel, TFunction<void(FGameplayTag, const UScriptStruct*, const void*)>&& Callback, const UScriptStruct* GameplayMessageStructType, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria);
+		FDanzmannGameplayMessagesListenerHandle RegisterListener_Internal(const FGameplayTag Channel, FDanzmannGameplayMessagesListenerData&& ListenerData, const UScriptStruct* GameplayMessageStructType, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria, const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup, const int32 LocalPlayerIndex, const FDanzmannNativeGameplayMessageType* NativeGameplayMessageType = nullptr);
+
+		/**
+		 * Internal helper for registering a UFunction invoked through reflection as a Gameplay Message listener.
+		 * @param Channel Gameplay Message channel to listen.
+		 * @param Object Object to invoke function on.
+		 * @param FunctionName Name of the function to invoke.
+		 * @param ChannelMatchCriteria Criteria to match Channel.
+		 * @param DeliveryTickGroup Tick group in which listener is invoked.
+		 * @param LocalPlayerIndex Local player listener receives Gameplay Messages of, INDEX_NONE for every local player.
+		 * @return Listener handle, invalid if function doesn't have the expected signature.
+		 */
+		FDanzmannGameplayMessagesListenerHandle RegisterScriptListener_Internal(const FGameplayTag Channel, UObject* Object, const FName FunctionName, const EDanzmannGameplayMessagesMatchCriteria ChannelMatchCriteria, const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup, const int32 LocalPlayerIndex);
+
+		/**
+		 * Internal helper for invoking a listener, whichever way it was registered.
+		 * @param Listener Listener to invoke.
+		 * @param Channel The Gameplay Message channel it was broadcast on.
+		 * @param GameplayMessageStructType The Gameplay Message struct type.
+		 * @param GameplayMessagePayload The Gameplay Message content.
+		 */
+		static void InvokeListener_Internal(const FDanzmannGameplayMessagesListenerData& Listener, const FGameplayTag Channel, const UScriptStruct* GameplayMessageStructType, const void* GameplayMessagePayload);
 
 		/**
 		 * Internal helper for unregistering a Gameplay Message listener.
@@ -180,7 +626,173 @@ class DANZMANNGAMEPLAYMESSAGES_API UDanzmannGameplayMessagesGameInstanceSubsyste
 		 * @param HandleId Listener's handle ID.
 		 */
 		void UnregisterListener_Internal(const FGameplayTag Channel, const int32 HandleId);
+
+		/**
+		 * Internal helper for removing a Gameplay Message listener from its owner index entry.
+		 * @param OwnerKey Key of the object owning listener.
+		 * @param Channel Channel listener is registered to.
+		 * @param HandleId Listener's handle ID.
+		 */
+		void RemoveOwnerListener_Internal(const FObjectKey OwnerKey, const FGameplayTag Channel, const int32 HandleId);
+
+		/**
+		 * Internal helper for removing every Gameplay Message listener owned by an object.
+		 * @param OwnerKey Key of the object owning listeners, which may be gone already.
+		 * @return Number of listeners removed.
+		 */
+		int32 UnregisterAllListenersForOwner_Internal(const FObjectKey OwnerKey);
+
+		/**
+		 * Internal helper for removing every Gameplay Message listener owned by any of the specified objects in one batch.
+		 * Each channel those owners have listeners on is compacted once, no matter how many of its listeners are removed.
+		 * Costs a pass over every listener on those channels, not just the removed ones.
+		 * @param OwnerKeys Keys of the objects owning listeners, which may be gone already.
+		 * @return Number of listeners removed.
+		 */
+		int32 UnregisterAllListenersForOwners_Internal(const TConstArrayView<FObjectKey> OwnerKeys);
+
+		/**
+		 * Remove listeners whose owner was destroyed (e.g., actors of a world left on travel) in a single batch once garbage collection is done,
+		 * along with listeners whose Gameplay Message struct type was garbage collected.
+		 */
+		void HandlePostGarbageCollect();
+
+		/**
+		 * Whether any listener was registered with a struct type that may be garbage collected (i.e., not native), whose listeners are checked after garbage collection.
+		 */
+		bool bHasCollectableListenerTypes = false;
+
+		/**
+		 * Internal helper for finding a registered Gameplay Message listener.
+		 * @param Channel Channel listener is registered to.
+		 * @param HandleId Listener's handle ID.
+		 * @return Listener data or nullptr if listener is no longer registered.
+		 */
+		const FDanzmannGameplayMessagesListenerData* FindListener_Internal(const FGameplayTag Channel, const int32 HandleId) const;
+
+		/**
+		 * Struct to store everything known about a Gameplay Message while it's being broadcast.
+		 */
+		struct FDanzmannGameplayMessageBroadcastContext
+		{
+			/**
+			 * Get a shared copy of the Gameplay Message, creating it the first time a consumer needs to keep the Gameplay Message past the broadcast.
+			 * Every later consumer of the same broadcast shares that copy.
+			 * @return Handle to the shared copy.
+			 */
+			const FDanzmannGameplayMessagePayloadHandle& GetOrCreateSharedPayload();
+
+			/**
+			 * Channel Gameplay Message is broadcast on.
+			 */
+			FGameplayTag Channel;
+
+			/**
+			 * The Gameplay Message struct type, nullptr if it's a native Gameplay Message.
+			 */
+			const UScriptStruct* GameplayMessageStructType = nullptr;
+
+			/**
+			 * The Gameplay Message content, owned by the broadcaster.
+			 */
+			const void* GameplayMessagePayload = nullptr;
+
+			/**
+			 * Native Gameplay Message type, if it's a native Gameplay Message.
+			 */
+			const FDanzmannNativeGameplayMessageType* NativeGameplayMessageType = nullptr;
+
+			/**
+			 * Instanced struct handed over by the broadcaster, moved into the shared copy instead of copied.
+			 */
+			FInstancedStruct* OwnedGameplayMessage = nullptr;
+
+			/**
+			 * Shared copy of the Gameplay Message, only valid once a consumer asked for it.
+			 */
+			FDanzmannGameplayMessagePayloadHandle SharedPayload;
+
+			/**
+			 * Index of the Gameplay Message queued by this broadcast for each delivery tick group, INDEX_NONE if none yet.
+			 */
+			int32 QueuedIndices[static_cast<int32>(EDanzmannGameplayMessagesDeliveryTickGroup::LastDemotable) + 1];
+		};
+
+		/**
+		 * Queue a Gameplay Message for a listener that asked to be invoked in a specific tick group.
+		 * The queued Gameplay Message references the broadcast shared copy, so the payload is only copied once no matter how many tick groups are involved.
+		 * @param DeliveryTickGroup Tick group in which listener is invoked.
+		 * @param Context Broadcast being dispatched.
+		 * @param ListenerChannel Channel listener is registered to.
+		 * @param ListenerHandleId Listener's handle ID.
+		 * @return Whether Gameplay Message was queued. If no world is available to tick in, nothing is queued.
+		 */
+		bool EnqueueDeferredGameplayMessage(const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup, FDanzmannGameplayMessageBroadcastContext& Context, const FGameplayTag ListenerChannel, const int32 ListenerHandleId);
+
+		/**
+		 * Deliver every Gameplay Message queued for the specified tick group. Called by the tick function of that tick group.
+		 * @param DeliveryTickGroup Tick group to flush.
+		 */
+		void FlushDeferredGameplayMessages(const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup);
+
+		/**
+		 * Make sure the tick function of the specified tick group is registered to the current world and enabled.
+		 * @param DeliveryTickGroup Tick group whose tick function should be registered.
+		 * @return Whether tick function is registered. Fails if Game Instance has no world to tick in.
+		 */
+		bool RegisterDeliveryTickFunction(const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup);
+
+		/**
+		 * Unregister every delivery tick function from the world they were registered to.
+		 */
+		void UnregisterDeliveryTickFunctions();
+
+		/**
+		 * Callback for when a world is cleaned up. Flushes any queued Gameplay Messages if delivery tick functions were ticking in that world.
+		 * @see more info in FWorldDelegates::OnWorldCleanup.
+		 */
+		void HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
 		
+		/**
+		 * Enum used to pick how a channel's listeners are selected when a Gameplay Message is broadcast to it.
+		 */
+		enum class EDanzmannChannelDispatchMode : uint8
+		{
+			// Packed listener metadata is filtered with vectorized compares. Used by every channel until it gets hot
+			Filtered,
+
+			// Hot channel with a single listener, which is checked and invoked directly. Hot channels with more listeners stay Filtered
+			SingleListener
+		};
+
+		/**
+		 * Struct to store broadcast stats of a channel.
+		 */
+		struct FDanzmannChannelStats
+		{
+			/**
+			 * Number of Gameplay Messages broadcast to channel.
+			 */
+			uint64 NumBroadcasts = 0;
+
+			/**
+			 * Total number of listeners selected by those broadcasts.
+			 */
+			uint64 TotalFanout = 0;
+
+			/**
+			 * Recent broadcasts per frame, smoothed over the last rate windows, used to tell whether channel is hot.
+			 * A single burst (e.g., while loading) fades out over the following windows instead of keeping channel hot.
+			 */
+			float RecentBroadcastsPerFrame = 0.0f;
+
+			/**
+			 * Frame current rate window started at and number of broadcasts within it. Not saved in channel profiles.
+			 */
+			uint64 WindowStartFrame = 0;
+			uint32 WindowNumBroadcasts = 0;
+		};
+
 		/**
 		 * Struct to store a list of all entries for a given channel.
 		 */
@@ -192,13 +804,230 @@ class DANZMANNGAMEPLAYMESSAGES_API UDanzmannGameplayMessagesGameInstanceSubsyste
 			TArray<FDanzmannGameplayMessagesListenerData> Listeners;
 
 			/**
-			 * Available handle ID for listener. This value is incremented each time a new listener is registered.
+			 * Packed type key of each listener, parallel to Listeners. Lets broadcasts filter listeners with vectorized compares.
+			 */
+			TArray<uint32> PackedTypeKeys;
+
+			/**
+			 * Gameplay Message struct type of each listener, parallel to Listeners. Confirms fast matches as plain pointers, without resolving listener types.
+			 * Listeners whose struct type is garbage collected are removed right after garbage collection, so these never dangle.
+			 */
+			TArray<const UScriptStruct*> PackedStructTypes;
+
+			/**
+			 * Packed flags (enabled, match criteria, wildcard type) of each listener, parallel to Listeners.
+			 */
+			TArray<uint32> PackedFlags;
+
+			/**
+			 * Broadcast stats gathered while channel has listeners.
+			 */
+			FDanzmannChannelStats Stats;
+
+			/**
+			 * Whether channel is hot, from its recent broadcasts per frame (carried on from the loaded channel profile until rate windows update it).
+			 */
+			bool bIsHot = false;
+
+			/**
+			 * How listeners are selected when a Gameplay Message is broadcast to this channel.
 			 */
-			int32 AvailableHandleId = 0;
+			EDanzmannChannelDispatchMode DispatchMode = EDanzmannChannelDispatchMode::Filtered;
 		};
 
+		/**
+		 * Struct to store listener lists of a declared channel and its parents, valid as long as no channel list is added to or removed from ListenerMap.
+		 */
+		struct FDanzmannDeclaredChannelCache
+		{
+			/**
+			 * ListenerMapGeneration these listener lists were found at.
+			 */
+			uint32 ListenerMapGeneration = 0;
+
+			/**
+			 * Listener lists of every tag in declared channel hierarchy, nullptr where a tag has no listeners.
+			 */
+			TArray<FDanzmannChannelListenerList*, TInlineAllocator<4>> ListenersLists;
+		};
+
+		/**
+		 * Internal helper for finding listener list of a declared channel hierarchy level, through its cache.
+		 * @param Channel Declared channel.
+		 * @param Level Level in channel hierarchy, 0 being channel itself.
+		 * @return Listener list, nullptr if tag at that level has no listeners.
+		 */
+		FDanzmannChannelListenerList* FindDeclaredChannelList_Internal(const FDanzmannGameplayMessageChannel& Channel, const int32 Level);
+
+		/**
+		 * Caches of declared channels, indexed by their dense index.
+		 */
+		TArray<FDanzmannDeclaredChannelCache> DeclaredChannelCaches;
+
+		/**
+		 * Incremented whenever a channel list is added to or removed from ListenerMap, which invalidates declared channel caches.
+		 */
+		uint32 ListenerMapGeneration = 1;
+
+		/**
+		 * Last listener handle ID given. Shared by every channel and never reset, so a handle ID is never reused by another listener
+		 * (e.g., once a channel list is removed and added again while Gameplay Messages are still queued for its old listeners).
+		 */
+		int32 AvailableHandleId = 0;
+
+		/**
+		 * Pick the dispatch mode of a channel from its hotness and number of listeners.
+		 * @param ListenersList Channel listeners.
+		 */
+		static void UpdateDispatchMode(FDanzmannChannelListenerList& ListenersList);
+
+		/**
+		 * Gather stats of a broadcast to a channel. Whenever a rate window ends, channel is promoted to (or demoted from) hot from its broadcast rate.
+		 * @param ListenersList Channel listeners.
+		 * @param Fanout Number of listeners selected by broadcast.
+		 */
+		static void RecordChannelBroadcast(FDanzmannChannelListenerList& ListenersList, const int32 Fanout);
+
+		/**
+		 * Minimum number of frames channel broadcast rate is measured over. Rate is divided by the frames that actually elapsed, since window only ends on a broadcast.
+		 */
+		static constexpr uint64 HotChannelWindowFrames = 30;
+
+		/**
+		 * Recent broadcasts per frame for a channel to be considered hot.
+		 */
+		static constexpr float HotChannelBroadcastsPerFrame = 1.0f;
+
+		/**
+		 * Weight of the rate window that just ended within a channel's recent broadcasts per frame.
+		 */
+		static constexpr float HotChannelRateSmoothing = 0.5f;
+
+		/**
+		 * Stats of channels that no longer have listeners, or loaded from a channel profile.
+		 */
+		TMap<FGameplayTag, FDanzmannChannelStats> ChannelProfile;
+
 		/**
 		 * Map of channels to their respective listeners. 
 		 */
 		TMap<FGameplayTag, FDanzmannChannelListenerList> ListenerMap;
+
+		/**
+		 * Struct to store what channel manifest tells about a channel.
+		 */
+		struct FDanzmannChannelManifestEntry
+		{
+			/**
+			 * Gameplay Message struct type used on channel, nullptr if unknown.
+			 */
+			TWeakObjectPtr<const UScriptStruct> GameplayMessageStructType = nullptr;
+
+			/**
+			 * Expected number of listeners on channel.
+			 */
+			int32 NumListeners = 0;
+		};
+
+		/**
+		 * Struct to store channel manifest resolved against loaded channels and struct types.
+		 */
+		struct FDanzmannChannelManifest
+		{
+			/**
+			 * Channels found in channel manifest.
+			 */
+			TMap<FGameplayTag, FDanzmannChannelManifestEntry> Channels;
+
+			/**
+			 * Every distinct Gameplay Message struct type found in channel manifest.
+			 */
+			TArray<TWeakObjectPtr<const UScriptStruct>> GameplayMessageStructTypes;
+		};
+
+		/**
+		 * Get channel manifest generated ahead of time, to pre-size channel lists and resolve type compatibility of listeners once.
+		 * Channel manifest is loaded once per process, the first time a router needs it, and shared by every router from then on.
+		 * @return Channel manifest, empty if there is none.
+		 * @see FDanzmannGameplayMessagesChannelManifest.
+		 */
+		static const FDanzmannChannelManifest& GetChannelManifest();
+
+		/**
+		 * Gameplay Message struct types found in channel manifest, kept referenced so listeners can compare against them as plain pointers.
+		 */
+		UPROPERTY(Transient)
+		TArray<TObjectPtr<const UScriptStruct>> ChannelManifestStructTypes;
+
+		/**
+		 * Map of listener owners to handles of their listeners, so they can all be removed at once without visiting every channel.
+		 */
+		TMap<FObjectKey, TArray<FDanzmannGameplayMessagesListenerHandle, TInlineAllocator<4>>> OwnerListenerMap;
+
+		/**
+		 * Handle of post garbage collection delegate, used to remove listeners of destroyed owners.
+		 */
+		FDelegateHandle PostGarbageCollectHandle;
+
+		/**
+		 * Names of the native Gameplay Message types seen so far, by type ID. Used to detect type ID collisions at registration.
+		 */
+		TMap<uint32, FName> NativeGameplayMessageTypeNames;
+
+		/**
+		 * Struct to store a Gameplay Message waiting to be delivered in a given tick group.
+		 */
+		struct FDanzmannDeferredGameplayMessage
+		{
+			/**
+			 * Channel Gameplay Message was broadcast on.
+			 */
+			FGameplayTag Channel;
+
+			/**
+			 * Shared copy of the Gameplay Message.
+			 */
+			FDanzmannGameplayMessagePayloadHandle Payload;
+
+			/**
+			 * Listeners waiting for this Gameplay Message.
+			 */
+			TArray<FDanzmannGameplayMessagesListenerHandle, TInlineAllocator<4>> Listeners;
+		};
+
+		/**
+		 * Struct to store every Gameplay Message queued for a given tick group and the tick function that flushes them.
+		 */
+		struct FDanzmannDeferredGameplayMessageQueue
+		{
+			/**
+			 * Tick function flushing this queue. Only created once a listener actually uses this tick group.
+			 */
+			TUniquePtr<FDanzmannGameplayMessagesTickFunction> TickFunction;
+
+			/**
+			 * Gameplay Messages waiting to be delivered. Its allocation is reused from one flush to the next.
+			 */
+			TArray<FDanzmannDeferredGameplayMessage> GameplayMessages;
+		};
+
+		/**
+		 * Number of delivery tick groups, Immediate included.
+		 */
+		static constexpr int32 NumDeliveryTickGroups = static_cast<int32>(EDanzmannGameplayMessagesDeliveryTickGroup::LastDemotable) + 1;
+
+		/**
+		 * Queues of deferred Gameplay Messages, indexed by EDanzmannGameplayMessagesDeliveryTickGroup. Immediate entry is never used.
+		 */
+		TStaticArray<FDanzmannDeferredGameplayMessageQueue, NumDeliveryTickGroups> DeferredQueues;
+
+		/**
+		 * World delivery tick functions are currently registered to.
+		 */
+		TWeakObjectPtr<UWorld> DeliveryTickWorld = nullptr;
+
+		/**
+		 * Handle to FWorldDelegates::OnWorldCleanup, bound once the first delivery tick function is registered.
+		 */
+		FDelegateHandle WorldCleanupHandle;
 };
@@ -0,0 +1,61 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "DanzmannGameplayMessagesListener.h"
+#include "Engine/EngineBaseTypes.h"
+
+#include "DanzmannGameplayMessagesTickFunction.generated.h"
+
+class UDanzmannGameplayMessagesGameInstanceSubsystem;
+
+/**
+ * Lightweight tick function used by Gameplay Messages subsystem to flush Gameplay Messages queued for a given delivery tick group.
+ * The subsystem only registers one of these for each delivery tick group in use and keeps it disabled while there is nothing queued.
+ */
+USTRUCT()
+struct FDanzmannGameplayMessagesTickFunction : public FTickFunction
+{
+    GENERATED_BODY()
+
+    /**
+     * Subsystem whose queued Gameplay Messages are flushed when this tick function runs.
+     */
+    UDanzmannGameplayMessagesGameInstanceSubsystem* Subsystem = nullptr;
+
+    /**
+     * Delivery tick group flushed by this tick function.
+     */
+    EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup = EDanzmannGameplayMessagesDeliveryTickGroup::Immediate;
+
+    /**
+     * @see more info in FTickFunction.
+     */
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+
+    /**
+     * @see more info in FTickFunction.
+     */
+    virtual FString DiagnosticMessage() override;
+
+    /**
+     * @see more info in FTickFunction.
+     */
+    virtual FName DiagnosticContext(bool bDetailed) override;
+
+    /**
+     * Convert a delivery tick group into the engine tick group it runs in.
+     * @param DeliveryTickGroup Delivery tick group to convert. Must not be Immediate.
+     * @return Engine tick group.
+     */
+    static ETickingGroup ToTickingGroup(const EDanzmannGameplayMessagesDeliveryTickGroup DeliveryTickGroup);
+};
+
+template<>
+struct TStructOpsTypeTraits<FDanzmannGameplayMessagesTickFunction> : public TStructOpsTypeTraitsBase2<FDanzmannGameplayMessagesTickFunction>
+{
+    enum
+    {
+        WithCopy = false
+    };
+};
@@ -0,0 +1,92 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+
+#include "DanzmannGameplayMessagesWorldSubsystem.generated.h"
+
+class UDanzmannGameplayMessagesGameInstanceSubsystem;
+
+/**
+ * Owns a Gameplay Messages router scoped to a single world, so broadcasts in that world only ever visit its own listeners.
+ * The router has the exact same API as the Game Instance one and is returned by UDanzmannGameplayMessagesGameInstanceSubsystem::Get().
+ * This subsystem is only created when bRouteByWorld is enabled in settings, and for editor preview worlds only with bRouteEditorPreviewWorlds.
+ * The router can also be used directly:
+ *  - UDanzmannGameplayMessagesWorldSubsystem::GetRouter(WorldContextObject);
+ *  - GetWorld()->GetSubsystem<UDanzmannGameplayMessagesWorldSubsystem>()->GetRouter();
+ *
+ * With bPersistAcrossSeamlessTravel enabled in settings, the router is handed over to the next world on seamless travel, along with its listeners
+ * and retained Gameplay Messages, instead of being destroyed with its world.
+ */
+UCLASS()
+class DANZMANNGAMEPLAYMESSAGES_API UDanzmannGameplayMessagesWorldSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+	public:
+		/**
+		 * @see more info in USubsystem.
+		 */
+		virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+		/**
+		 * @see more info in USubsystem.
+		 */
+		virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+		/**
+		 * @see more info in USubsystem.
+		 */
+		virtual void Deinitialize() override;
+
+		/**
+		 * @see more info in UWorldSubsystem.
+		 */
+		virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+		/**
+		 * Get router of the world of the specified object.
+		 * @return Router of the world, nullptr if world doesn't have one.
+		 */
+		static UDanzmannGameplayMessagesGameInstanceSubsystem* GetRouter(const UObject* WorldContextObject);
+
+		/**
+		 * Get router of this world.
+		 * @return Router of this world.
+		 */
+		UDanzmannGameplayMessagesGameInstanceSubsystem* GetRouter() const
+		{
+			return Router;
+		}
+
+	protected:
+		/**
+		 * @see more info in UWorldSubsystem.
+		 */
+		virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	private:
+		/**
+		 * Hand router over to the Game Instance router when seamless travel leaves this world, so the next world can pick it up.
+		 * @param World World being traveled from.
+		 */
+		void HandleSeamlessTravelTransition(UWorld* World);
+
+		/**
+		 * Pick up the router handed over by the world traveled from, if there is one and this world router has nothing registered yet.
+		 * @return Whether a router was picked up.
+		 */
+		bool AdoptTravelingRouter();
+
+		/**
+		 * Handle of seamless travel transition delegate.
+		 */
+		FDelegateHandle SeamlessTravelTransitionHandle;
+
+		/**
+		 * Router of this world.
+		 */
+		UPROPERTY(Transient)
+		TObjectPtr<UDanzmannGameplayMessagesGameInstanceSubsystem> Router = nullptr;
+};
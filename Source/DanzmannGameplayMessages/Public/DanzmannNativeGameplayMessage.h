@@ -0,0 +1,89 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Struct describing a native Gameplay Message type: a plain C++ type without reflection (no USTRUCT()).
+ * Native Gameplay Messages are matched by type ID only, so they skip every UScriptStruct check when dispatched.
+ * @see DANZMANN_DECLARE_NATIVE_GAMEPLAY_MESSAGE().
+ */
+struct FDanzmannNativeGameplayMessageType
+{
+	/**
+	 * Compile-time type ID, computed from type name.
+	 */
+	uint32 Id = 0;
+
+	/**
+	 * Type name, used for logging.
+	 */
+	const TCHAR* Name = nullptr;
+
+	/**
+	 * Type size, used when Gameplay Message has to be copied (e.g., queued for a specific tick group).
+	 */
+	uint32 Size = 0;
+
+	/**
+	 * Type alignment, used when Gameplay Message has to be copied (e.g., queued for a specific tick group).
+	 */
+	uint32 Alignment = 0;
+};
+
+/**
+ * Traits used to tell whether a type is a native Gameplay Message. Specialized by DANZMANN_DECLARE_NATIVE_GAMEPLAY_MESSAGE().
+ */
+template<typename TGameplayMessage>
+struct TDanzmannNativeGameplayMessageTraits
+{
+	static constexpr bool bIsNative = false;
+};
+
+namespace DanzmannGameplayMessages
+{
+	/**
+	 * Biggest alignment supported for native Gameplay Messages.
+	 */
+	static constexpr uint32 MaxNativeGameplayMessageAlignment = 16;
+
+	/**
+	 * Compute a native Gameplay Message type ID from its name (FNV-1a). Never returns 0, which is reserved for non-native types.
+	 * @param Name Type name.
+	 * @return Type ID.
+	 */
+	constexpr uint32 HashNativeGameplayMessageTypeName(const char* Name)
+	{
+		uint32 Hash = 2166136261u;
+		for (; *Name != '\0'; ++Name)
+		{
+			Hash ^= static_cast<uint8>(*Name);
+			Hash *= 16777619u;
+		}
+
+		return Hash != 0 ? Hash : 1;
+	}
+}
+
+/**
+ * Declare a plain C++ type as a native Gameplay Message, so it can be broadcast and listened to without being a USTRUCT().
+ * Must be used in the global namespace, with the fully qualified type name, after the type is declared.
+ * Native Gameplay Messages must be trivially copyable and are only delivered to listeners of the exact same type.
+ * @note Usage example:
+ *       struct FMyProjectGameplayMessage_Footstep
+ *       {
+ *           FVector Location;
+ *           float Loudness;
+ *       };
+ *       DANZMANN_DECLARE_NATIVE_GAMEPLAY_MESSAGE(FMyProjectGameplayMessage_Footstep);
+ */
+#define DANZMANN_DECLARE_NATIVE_GAMEPLAY_MESSAGE(NativeType) \
+	template<> \
+	struct TDanzmannNativeGameplayMessageTraits<NativeType> \
+	{ \
+		static_assert(std::is_trivially_copyable_v<NativeType> && std::is_trivially_destructible_v<NativeType>, "Native Gameplay Messages must be trivially copyable and destructible."); \
+		static_assert(alignof(NativeType) <= DanzmannGameplayMessages::MaxNativeGameplayMessageAlignment, "Native Gameplay Message alignment is not supported."); \
+		static constexpr bool bIsNative = true; \
+		static constexpr FDanzmannNativeGameplayMessageType Type = { DanzmannGameplayMessages::HashNativeGameplayMessageTypeName(#NativeType), TEXT(#NativeType), sizeof(NativeType), alignof(NativeType) }; \
+	}
@@ -0,0 +1,80 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "DanzmannGameplayMessagesListener.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UDanzmannGameplayMessagesGameInstanceSubsystem;
+
+/**
+ * Move-only owner of a Gameplay Messages listener, which is unregistered when this goes out of scope (or is reset).
+ * Meant to be stored as a member of whatever registered the listener, so forgetting to unregister it is no longer possible.
+ * @note Usage example:
+ *       ScopedListener = FDanzmannScopedGameplayMessageListener(
+ *           GameplayMessagesSubsystem,
+ *           GameplayMessagesSubsystem->RegisterListener(FGameplayTag(), this, &ThisClass::CallbackFunction)
+ *       );
+ */
+class DANZMANNGAMEPLAYMESSAGES_API FDanzmannScopedGameplayMessageListener
+{
+	public:
+		FDanzmannScopedGameplayMessageListener() = default;
+
+		/**
+		 * Take ownership of a registered listener.
+		 * @param Subsystem Subsystem listener is registered to.
+		 * @param Handle The handle returned by RegisterListener().
+		 */
+		FDanzmannScopedGameplayMessageListener(UDanzmannGameplayMessagesGameInstanceSubsystem* Subsystem, const FDanzmannGameplayMessagesListenerHandle Handle);
+
+		FDanzmannScopedGameplayMessageListener(FDanzmannScopedGameplayMessageListener&& Other);
+
+		FDanzmannScopedGameplayMessageListener& operator=(FDanzmannScopedGameplayMessageListener&& Other);
+
+		FDanzmannScopedGameplayMessageListener(const FDanzmannScopedGameplayMessageListener&) = delete;
+
+		FDanzmannScopedGameplayMessageListener& operator=(const FDanzmannScopedGameplayMessageListener&) = delete;
+
+		~FDanzmannScopedGameplayMessageListener();
+
+		/**
+		 * Unregister owned listener, if any.
+		 */
+		void Reset();
+
+		/**
+		 * Give up ownership of listener without unregistering it.
+		 * @return Handle of listener, which has to be unregistered manually from now on.
+		 */
+		FDanzmannGameplayMessagesListenerHandle Release();
+
+		/**
+		 * Check if a listener is owned.
+		 * @return Whether a listener is owned or not.
+		 */
+		bool IsValid() const
+		{
+			return Handle.IsValid();
+		}
+
+		/**
+		 * Get handle of owned listener.
+		 * @return Handle of owned listener, invalid if there is none.
+		 */
+		const FDanzmannGameplayMessagesListenerHandle& GetHandle() const
+		{
+			return Handle;
+		}
+
+	private:
+		/**
+		 * Subsystem listener is registered to. Nothing is unregistered if it's gone by then.
+		 */
+		TWeakObjectPtr<UDanzmannGameplayMessagesGameInstanceSubsystem> Subsystem = nullptr;
+
+		/**
+		 * Handle of owned listener.
+		 */
+		FDanzmannGameplayMessagesListenerHandle Handle;
+};
@@ -0,0 +1,33 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class DanzmannGameplayMessagesAnalytics : ModuleRules
+{
+	public DanzmannGameplayMessagesAnalytics(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"DanzmannGameplayMessages",
+				"DeveloperSettings",
+				"Engine",
+				"GameplayTags"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"Json",
+				"JsonUtilities",
+				"Networking",
+				"Sockets"
+			}
+		);
+	}
+}
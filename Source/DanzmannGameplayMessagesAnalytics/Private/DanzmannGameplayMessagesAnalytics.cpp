@@ -0,0 +1,17 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesAnalytics.h"
+
+#define LOCTEXT_NAMESPACE "FDanzmannGameplayMessagesAnalyticsModule"
+
+void FDanzmannGameplayMessagesAnalyticsModule::StartupModule()
+{
+}
+
+void FDanzmannGameplayMessagesAnalyticsModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+	
+IMPLEMENT_MODULE(FDanzmannGameplayMessagesAnalyticsModule, DanzmannGameplayMessagesAnalytics)
@@ -0,0 +1,224 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesAnalyticsExporter.h"
+#include "DanzmannGameplayMessagesAnalyticsSettings.h"
+#include "DanzmannGameplayMessagesGameInstanceSubsystem.h"
+#include "Engine/World.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "StructUtils/InstancedStruct.h"
+#include "UObject/UnrealType.h"
+
+namespace DanzmannGameplayMessages::Private
+{
+	static void CaptureStructObjectPaths(const UStruct* StructType, const void* Data, FDanzmannGameplayMessagesAnalyticsRecord& Record);
+
+	/**
+	 * Capture path of every object referenced by a property value, so writer thread never has to resolve them.
+	 * @param Property Property to capture object references of.
+	 * @param Value Property value.
+	 * @param Record Record capturing object paths.
+	 */
+	static void CaptureObjectPaths(const FProperty* Property, const void* Value, FDanzmannGameplayMessagesAnalyticsRecord& Record)
+	{
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			if (StructProperty->Struct == FInstancedStruct::StaticStruct())
+			{
+				const FInstancedStruct& InstancedStruct = *static_cast<const FInstancedStruct*>(Value);
+				if (InstancedStruct.IsValid())
+				{
+					CaptureStructObjectPaths(InstancedStruct.GetScriptStruct(), InstancedStruct.GetMemory(), Record);
+				}
+			}
+			else
+			{
+				CaptureStructObjectPaths(StructProperty->Struct, Value, Record);
+			}
+		}
+		else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			FScriptArrayHelper ArrayHelper(ArrayProperty, Value);
+			for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+			{
+				CaptureObjectPaths(ArrayProperty->Inner, ArrayHelper.GetRawPtr(Index), Record);
+			}
+		}
+		else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			FScriptSetHelper SetHelper(SetProperty, Value);
+			for (int32 Index = 0; Index < SetHelper.GetMaxIndex(); ++Index)
+			{
+				if (SetHelper.IsValidIndex(Index))
+				{
+					CaptureObjectPaths(SetProperty->ElementProp, SetHelper.GetElementPtr(Index), Record);
+				}
+			}
+		}
+		else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			FScriptMapHelper MapHelper(MapProperty, Value);
+			for (int32 Index = 0; Index < MapHelper.GetMaxIndex(); ++Index)
+			{
+				if (MapHelper.IsValidIndex(Index))
+				{
+					CaptureObjectPaths(MapProperty->KeyProp, MapHelper.GetKeyPtr(Index), Record);
+					CaptureObjectPaths(MapProperty->ValueProp, MapHelper.GetValuePtr(Index), Record);
+				}
+			}
+		}
+		else if (Property->IsA<FWeakObjectProperty>())
+		{
+			const FWeakObjectPtr& WeakObject = *static_cast<const FWeakObjectPtr*>(Value);
+			if (const UObject* Object = WeakObject.Get(); (Object != nullptr) && (Record.FindObjectPath(WeakObject) == nullptr))
+			{
+				Record.WeakObjectPaths.Emplace(WeakObject, Object->GetPathName());
+			}
+		}
+		else if (Property->IsA<FInterfaceProperty>() || (Property->IsA<FObjectPropertyBase>() && !Property->IsA<FSoftObjectProperty>() && !Property->IsA<FLazyObjectProperty>()))
+		{
+			// Keyed by the reference as stored in payload, which is what writer thread looks up without dereferencing it
+			const UPTRINT ObjectReference = *static_cast<const UPTRINT*>(Value);
+			const UObject* Object = Property->IsA<FInterfaceProperty>() ? static_cast<const FScriptInterface*>(Value)->GetObject() : CastFieldChecked<FObjectPropertyBase>(Property)->GetObjectPropertyValue(Value);
+			if ((Object != nullptr) && (Record.FindObjectPath(ObjectReference) == nullptr))
+			{
+				Record.ObjectPaths.Emplace(ObjectReference, Object->GetPathName());
+			}
+		}
+	}
+
+	/**
+	 * Capture path of every object referenced by a struct.
+	 * @param StructType Struct type.
+	 * @param Data Struct memory.
+	 * @param Record Record capturing object paths.
+	 */
+	static void CaptureStructObjectPaths(const UStruct* StructType, const void* Data, FDanzmannGameplayMessagesAnalyticsRecord& Record)
+	{
+		for (TFieldIterator<FProperty> It(StructType); It; ++It)
+		{
+			for (int32 ArrayIndex = 0; ArrayIndex < It->ArrayDim; ++ArrayIndex)
+			{
+				CaptureObjectPaths(*It, It->ContainerPtrToValuePtr<void>(Data, ArrayIndex), Record);
+			}
+		}
+	}
+
+	/**
+	 * Whether a struct type may reference objects, strongly or weakly, so Gameplay Messages without any skip capturing object paths.
+	 * @param StructType Struct type.
+	 * @return Whether struct type may reference objects.
+	 */
+	static bool MayReferenceObjects(const UScriptStruct* StructType)
+	{
+		// Instanced structs can hold any struct type, so they're walked anyway
+		if (StructType == FInstancedStruct::StaticStruct())
+		{
+			return true;
+		}
+
+		// Instanced structs held by properties report object references themselves
+		TArray<const FStructProperty*> EncounteredStructProperties;
+		for (TFieldIterator<FProperty> It(StructType); It; ++It)
+		{
+			if (It->ContainsObjectReference(EncounteredStructProperties, EPropertyObjectReferenceType::Strong | EPropertyObjectReferenceType::Weak))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
+
+bool UDanzmannGameplayMessagesAnalyticsExporter::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UDanzmannGameplayMessagesAnalyticsSettings* Settings = GetDefault<UDanzmannGameplayMessagesAnalyticsSettings>();
+	return Super::ShouldCreateSubsystem(Outer) && Settings->bEnabled && !Settings->ExportedChannels.IsEmpty();
+}
+
+void UDanzmannGameplayMessagesAnalyticsExporter::PostInitialize()
+{
+	Super::PostInitialize();
+
+	// Routers are created when worlds are initialized, so the one of this world is around by now
+	const UWorld* World = GetWorld();
+	if (!UDanzmannGameplayMessagesGameInstanceSubsystem::HasInstance(World))
+	{
+		return;
+	}
+
+	const UDanzmannGameplayMessagesAnalyticsSettings* Settings = GetDefault<UDanzmannGameplayMessagesAnalyticsSettings>();
+	const FString BaseFilename = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Analytics"), FString::Printf(TEXT("GameplayMessages_%s_%s"), *World->GetMapName(), *FDateTime::Now().ToString()));
+	Writer = MakeUnique<FDanzmannGameplayMessagesAnalyticsWriter>(*Settings, BaseFilename);
+
+	UDanzmannGameplayMessagesGameInstanceSubsystem* GameplayMessagesSubsystem = UDanzmannGameplayMessagesGameInstanceSubsystem::Get(World);
+	for (int32 Index = 0; Index < Settings->ExportedChannels.Num(); ++Index)
+	{
+		const FDanzmannGameplayMessagesAnalyticsChannel& ExportedChannel = Settings->ExportedChannels[Index];
+		Samplers.Emplace(FMath::Clamp(ExportedChannel.SamplingRate, 0.0f, 1.0f), 0.0f);
+
+		if (ExportedChannel.Channel.IsValid() && (ExportedChannel.SamplingRate > 0.0f))
+		{
+			Listeners.Emplace(GameplayMessagesSubsystem, GameplayMessagesSubsystem->RegisterListener(ExportedChannel.Channel, nullptr,
+				[this, Index](const FGameplayTag Channel, const FConstStructView GameplayMessage)
+				{
+					HandleGameplayMessage(Index, Channel, GameplayMessage);
+				},
+				EDanzmannGameplayMessagesMatchCriteria::PartialMatch
+			));
+		}
+	}
+
+}
+
+void UDanzmannGameplayMessagesAnalyticsExporter::Deinitialize()
+{
+	Listeners.Reset();
+	Samplers.Reset();
+	StructTypesReferencingObjects.Reset();
+
+	// Writer thread writes every queued Gameplay Message before it's done
+	Writer.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UDanzmannGameplayMessagesAnalyticsExporter::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return (WorldType == EWorldType::Game) || (WorldType == EWorldType::PIE);
+}
+
+void UDanzmannGameplayMessagesAnalyticsExporter::HandleGameplayMessage(const int32 ExportedChannelIndex, const FGameplayTag Channel, const FConstStructView GameplayMessage)
+{
+	TPair<float, float>& Sampler = Samplers[ExportedChannelIndex];
+	Sampler.Value += Sampler.Key;
+	if ((Sampler.Value < 1.0f) || !Writer.IsValid() || (GameplayMessage.GetScriptStruct() == nullptr))
+	{
+		return;
+	}
+	Sampler.Value -= 1.0f;
+
+	// Only a copy is made here, serialization and I/O happen on writer thread
+	FDanzmannGameplayMessagesAnalyticsRecord Record;
+	Record.Channel = Channel;
+	Record.Time = GetWorld()->GetTimeSeconds();
+	Record.Frame = GFrameCounter;
+	Record.Payload = FDanzmannGameplayMessagePayload::Create(GameplayMessage.GetScriptStruct(), GameplayMessage.GetMemory());
+
+	// Objects may be garbage collected before writer thread gets to the copy, so their paths are captured now and only for struct types that may reference them
+	const UScriptStruct* StructType = GameplayMessage.GetScriptStruct();
+	const FObjectKey StructTypeKey(StructType);
+	const bool* bMayReferenceObjects = StructTypesReferencingObjects.Find(StructTypeKey);
+	if (bMayReferenceObjects == nullptr)
+	{
+		bMayReferenceObjects = &StructTypesReferencingObjects.Add(StructTypeKey, DanzmannGameplayMessages::Private::MayReferenceObjects(StructType));
+	}
+
+	if (*bMayReferenceObjects)
+	{
+		DanzmannGameplayMessages::Private::CaptureStructObjectPaths(StructType, GameplayMessage.GetMemory(), Record);
+	}
+
+	Writer->Enqueue(MoveTemp(Record));
+}
@@ -0,0 +1,9 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesAnalyticsSettings.h"
+
+UDanzmannGameplayMessagesAnalyticsSettings::UDanzmannGameplayMessagesAnalyticsSettings()
+{
+	CategoryName = TEXT("Plugins");
+	SectionName = TEXT("DanzmannGameplayMessagesAnalytics");
+}
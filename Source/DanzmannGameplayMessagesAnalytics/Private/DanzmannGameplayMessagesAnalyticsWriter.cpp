@@ -0,0 +1,340 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesAnalyticsWriter.h"
+#include "Common/UdpSocketBuilder.h"
+#include "DanzmannGameplayMessageCodec.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/FileManager.h"
+#include "HAL/RunnableThread.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "JsonObjectConverter.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "StructUtils/InstancedStruct.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDanzmannGameplayMessagesAnalytics, Log, All);
+
+namespace DanzmannGameplayMessages::Private
+{
+	/**
+	 * Binary analytics file identifier and version.
+	 */
+	static constexpr uint32 AnalyticsFileMagic = 0x44474D41;
+	static constexpr int32 AnalyticsFileVersion = 1;
+
+	/**
+	 * Biggest datagram sent to socket sink.
+	 */
+	static constexpr int32 MaxAnalyticsDatagramSize = 60000;
+
+	/**
+	 * Export an object reference of a record to JSON from its captured path, without resolving it.
+	 * @param Record Record being exported.
+	 * @param Property Property being exported.
+	 * @param Value Property value, within record payload.
+	 * @param ExportCallback Callback exporting nested values, for instanced structs.
+	 * @return JSON value, nullptr if property isn't an object reference and should be exported as usual.
+	 */
+	static TSharedPtr<FJsonValue> ExportObjectReference(const FDanzmannGameplayMessagesAnalyticsRecord& Record, const FProperty* Property, const void* Value, const FJsonObjectConverter::CustomExportCallback* ExportCallback)
+	{
+		const FString* ObjectPath = nullptr;
+		if (Property->IsA<FWeakObjectProperty>())
+		{
+			ObjectPath = Record.FindObjectPath(*static_cast<const FWeakObjectPtr*>(Value));
+		}
+		else if (Property->IsA<FLazyObjectProperty>())
+		{
+			return MakeShared<FJsonValueString>(static_cast<const FLazyObjectPtr*>(Value)->GetUniqueID().ToString());
+		}
+		else if (Property->IsA<FInterfaceProperty>() || (Property->IsA<FObjectPropertyBase>() && !Property->IsA<FSoftObjectProperty>()))
+		{
+			ObjectPath = Record.FindObjectPath(*static_cast<const UPTRINT*>(Value));
+		}
+		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property); (StructProperty != nullptr) && (StructProperty->Struct == FInstancedStruct::StaticStruct()))
+		{
+			// Instanced structs would otherwise be exported as text, resolving their object references
+			const FInstancedStruct& InstancedStruct = *static_cast<const FInstancedStruct*>(Value);
+			const TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+			if (InstancedStruct.IsValid())
+			{
+				FJsonObjectConverter::UStructToJsonObject(InstancedStruct.GetScriptStruct(), InstancedStruct.GetMemory(), JsonObject, 0, 0, ExportCallback);
+			}
+
+			return MakeShared<FJsonValueObject>(JsonObject);
+		}
+		else
+		{
+			return nullptr;
+		}
+
+		if (ObjectPath == nullptr)
+		{
+			return MakeShared<FJsonValueNull>();
+		}
+
+		return MakeShared<FJsonValueString>(*ObjectPath);
+	}
+
+	/**
+	 * Proxy archive writing object references of a record as their captured paths, without resolving them. Paths are read back by FDanzmannGameplayMessageCodec.
+	 */
+	class FCapturedObjectPathProxyArchive : public FObjectAndNameAsStringProxyArchive
+	{
+		public:
+			FCapturedObjectPathProxyArchive(FArchive& InInnerArchive, const FDanzmannGameplayMessagesAnalyticsRecord& InRecord) :
+				FObjectAndNameAsStringProxyArchive(InInnerArchive, false),
+				Record(InRecord)
+			{
+			}
+
+			virtual FArchive& operator<<(UObject*& Obj) override
+			{
+				return WriteObjectPath(Record.FindObjectPath(reinterpret_cast<UPTRINT>(Obj)));
+			}
+
+			virtual FArchive& operator<<(FObjectPtr& Obj) override
+			{
+				UObject* Object = Obj.Get();
+				return *this << Object;
+			}
+
+			virtual FArchive& operator<<(FWeakObjectPtr& Obj) override
+			{
+				return WriteObjectPath(Record.FindObjectPath(Obj));
+			}
+
+		private:
+			/**
+			 * Write object path the way FObjectAndNameAsStringProxyArchive does, empty for null or unknown references.
+			 * @param ObjectPath Object path, nullptr if unknown.
+			 * @return This archive.
+			 */
+			FArchive& WriteObjectPath(const FString* ObjectPath)
+			{
+				FString Path = ObjectPath != nullptr ? *ObjectPath : FString();
+				InnerArchive << Path;
+				return *this;
+			}
+
+			/**
+			 * Record being written.
+			 */
+			const FDanzmannGameplayMessagesAnalyticsRecord& Record;
+	};
+}
+
+FDanzmannGameplayMessagesAnalyticsWriter::FDanzmannGameplayMessagesAnalyticsWriter(const UDanzmannGameplayMessagesAnalyticsSettings& Settings, const FString& InBaseFilename) :
+	WakeUpEvent(EEventMode::AutoReset),
+	Format(Settings.Format),
+	Sink(Settings.Sink),
+	MaxFileSize(static_cast<int64>(FMath::Max(Settings.MaxFileSizeMB, 1)) * 1024 * 1024),
+	FlushIntervalMs(static_cast<uint32>(FMath::Max(Settings.FlushInterval, 0.01f) * 1000.0f)),
+	BaseFilename(InBaseFilename)
+{
+	if (Sink == EDanzmannGameplayMessagesAnalyticsSink::Socket)
+	{
+		FIPv4Endpoint SinkEndpoint;
+		if (FIPv4Endpoint::Parse(Settings.SinkEndpoint, SinkEndpoint))
+		{
+			SinkAddress = SinkEndpoint.ToInternetAddr();
+			Socket = FUdpSocketBuilder(TEXT("DanzmannGameplayMessagesAnalyticsWriter")).Build();
+		}
+
+		if (Socket == nullptr)
+		{
+			UE_LOG(LogDanzmannGameplayMessagesAnalytics, Error, TEXT("[%hs] Failed to create socket to sink endpoint %s, Gameplay Messages aren't exported."), __FUNCTION__, *Settings.SinkEndpoint);
+		}
+	}
+
+	Thread.Reset(FRunnableThread::Create(this, TEXT("DanzmannGameplayMessagesAnalyticsWriter"), 0, TPri_BelowNormal));
+}
+
+FDanzmannGameplayMessagesAnalyticsWriter::~FDanzmannGameplayMessagesAnalyticsWriter()
+{
+	// Thread writes every record left before it's done
+	if (Thread.IsValid())
+	{
+		Thread->Kill(true);
+		Thread.Reset();
+	}
+
+	File.Reset();
+
+	if (Socket != nullptr)
+	{
+		Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+		Socket = nullptr;
+	}
+}
+
+void FDanzmannGameplayMessagesAnalyticsWriter::Enqueue(FDanzmannGameplayMessagesAnalyticsRecord&& Record)
+{
+	Records.Enqueue(MoveTemp(Record));
+}
+
+uint32 FDanzmannGameplayMessagesAnalyticsWriter::Run()
+{
+	while (!bIsStopping.load())
+	{
+		WakeUpEvent->Wait(FlushIntervalMs);
+
+		SerializeRecords();
+		WriteSerializedRecords();
+	}
+
+	// Records queued until the very end still get out
+	SerializeRecords();
+	WriteSerializedRecords();
+
+	return 0;
+}
+
+void FDanzmannGameplayMessagesAnalyticsWriter::Stop()
+{
+	bIsStopping.store(true);
+	WakeUpEvent->Trigger();
+}
+
+void FDanzmannGameplayMessagesAnalyticsWriter::SerializeRecords()
+{
+	FDanzmannGameplayMessagesAnalyticsRecord Record;
+	while (Records.Dequeue(Record))
+	{
+		const FConstStructView GameplayMessage = Record.Payload.IsValid() ? Record.Payload->GetStructView() : FConstStructView();
+		if (GameplayMessage.GetScriptStruct() != nullptr)
+		{
+			if (Format == EDanzmannGameplayMessagesAnalyticsFormat::Json)
+			{
+				// Object references are exported from their captured paths, objects may be garbage collected by now
+				FJsonObjectConverter::CustomExportCallback ExportCallback;
+				ExportCallback.BindLambda(
+					[&Record, &ExportCallback]
+					(FProperty* Property, const void* Value)
+					{
+						return DanzmannGameplayMessages::Private::ExportObjectReference(Record, Property, Value, &ExportCallback);
+					}
+				);
+
+				FString GameplayMessageJson;
+				FJsonObjectConverter::UStructToJsonObjectString(GameplayMessage.GetScriptStruct(), GameplayMessage.GetMemory(), GameplayMessageJson, 0, 0, 0, &ExportCallback, false);
+
+				const FString Line = FString::Printf(TEXT("{\"channel\":\"%s\",\"time\":%.3f,\"frame\":%llu,\"message\":%s}\n"), *Record.Channel.ToString(), Record.Time, Record.Frame, *GameplayMessageJson);
+				const FTCHARToUTF8 Utf8Line(*Line);
+				SerializedRecords.Append(reinterpret_cast<const uint8*>(Utf8Line.Get()), Utf8Line.Length());
+			}
+			else
+			{
+				FMemoryWriter Writer(SerializedRecords, true, true);
+				Writer << Record.Time << Record.Frame;
+				DanzmannGameplayMessages::Private::FCapturedObjectPathProxyArchive ContentWriter(Writer, Record);
+				FDanzmannGameplayMessageCodec::Encode(Writer, ContentWriter, Record.Channel, GameplayMessage);
+			}
+
+			SerializedRecordEnds.Add(SerializedRecords.Num());
+		}
+
+		// Copy is released here, on writer thread
+		Record = FDanzmannGameplayMessagesAnalyticsRecord();
+	}
+}
+
+void FDanzmannGameplayMessagesAnalyticsWriter::WriteSerializedRecords()
+{
+	if (SerializedRecords.IsEmpty())
+	{
+		return;
+	}
+
+	if (Sink == EDanzmannGameplayMessagesAnalyticsSink::File)
+	{
+		// Files are rotated between records, so each one only holds whole records
+		int32 RecordStart = 0;
+		for (const int32 RecordEnd : SerializedRecordEnds)
+		{
+			const int32 RecordSize = RecordEnd - RecordStart;
+			if (!File.IsValid() || ((NumFileRecords > 0) && ((FileSize + RecordSize) > MaxFileSize)))
+			{
+				OpenNextFile();
+				if (!File.IsValid())
+				{
+					break;
+				}
+			}
+
+			File->Serialize(SerializedRecords.GetData() + RecordStart, RecordSize);
+			FileSize += RecordSize;
+			++NumFileRecords;
+
+			RecordStart = RecordEnd;
+		}
+
+		if (File.IsValid())
+		{
+			File->Flush();
+		}
+	}
+	else if ((Socket != nullptr) && SinkAddress.IsValid())
+	{
+		auto SendDatagram = [this](const int32 Start, const int32 End)
+		{
+			if (End > Start)
+			{
+				int32 BytesSent = 0;
+				Socket->SendTo(SerializedRecords.GetData() + Start, End - Start, BytesSent, *SinkAddress);
+			}
+		};
+
+		// Datagrams are split between records, so each one only holds whole records
+		int32 DatagramStart = 0;
+		int32 RecordStart = 0;
+		for (const int32 RecordEnd : SerializedRecordEnds)
+		{
+			if ((RecordEnd - RecordStart) > DanzmannGameplayMessages::Private::MaxAnalyticsDatagramSize)
+			{
+				UE_LOG(LogDanzmannGameplayMessagesAnalytics, Warning, TEXT("[%hs] Exported Gameplay Message doesn't fit in a datagram (%d bytes), it's dropped."), __FUNCTION__, RecordEnd - RecordStart);
+				SendDatagram(DatagramStart, RecordStart);
+				DatagramStart = RecordEnd;
+			}
+			else if ((RecordEnd - DatagramStart) > DanzmannGameplayMessages::Private::MaxAnalyticsDatagramSize)
+			{
+				SendDatagram(DatagramStart, RecordStart);
+				DatagramStart = RecordStart;
+			}
+
+			RecordStart = RecordEnd;
+		}
+
+		SendDatagram(DatagramStart, RecordStart);
+	}
+
+	SerializedRecords.Reset();
+	SerializedRecordEnds.Reset();
+}
+
+void FDanzmannGameplayMessagesAnalyticsWriter::OpenNextFile()
+{
+	File.Reset();
+	FileSize = 0;
+	NumFileRecords = 0;
+
+	const TCHAR* Extension = Format == EDanzmannGameplayMessagesAnalyticsFormat::Json ? TEXT("jsonl") : TEXT("bin");
+	const FString Filename = FString::Printf(TEXT("%s_%03d.%s"), *BaseFilename, FileIndex++, Extension);
+	File.Reset(IFileManager::Get().CreateFileWriter(*Filename, FILEWRITE_AllowRead));
+	if (!File.IsValid())
+	{
+		UE_LOG(LogDanzmannGameplayMessagesAnalytics, Error, TEXT("[%hs] Failed to create analytics file %s."), __FUNCTION__, *Filename);
+		return;
+	}
+
+	if (Format == EDanzmannGameplayMessagesAnalyticsFormat::Binary)
+	{
+		uint32 Magic = DanzmannGameplayMessages::Private::AnalyticsFileMagic;
+		int32 Version = DanzmannGameplayMessages::Private::AnalyticsFileVersion;
+		*File << Magic << Version;
+		FileSize = File->Tell();
+	}
+}
@@ -0,0 +1,74 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "DanzmannGameplayMessagesAnalyticsWriter.h"
+#include "DanzmannScopedGameplayMessageListener.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "DanzmannGameplayMessagesAnalyticsExporter.generated.h"
+
+/**
+ * Exporter streaming Gameplay Messages of selected channels out as analytics events, so nobody has to write listeners formatting them on the game thread.
+ * Sampled Gameplay Messages are copied into a lock-free queue from within the broadcast call, then serialized (JSON or binary) and written
+ * to rotating files or a loopback socket by a background writer thread. Sampling is deterministic: a rate of 0.25 exports exactly every fourth Gameplay Message.
+ * @see UDanzmannGameplayMessagesAnalyticsSettings.
+ * @note Native Gameplay Messages have no reflection data, they're not exported.
+ */
+UCLASS()
+class DANZMANNGAMEPLAYMESSAGESANALYTICS_API UDanzmannGameplayMessagesAnalyticsExporter : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+	public:
+		/**
+		 * @see more info in USubsystem.
+		 */
+		virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+		/**
+		 * @see more info in UWorldSubsystem.
+		 */
+		virtual void PostInitialize() override;
+
+		/**
+		 * @see more info in USubsystem.
+		 */
+		virtual void Deinitialize() override;
+
+	protected:
+		/**
+		 * @see more info in UWorldSubsystem.
+		 */
+		virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	private:
+		/**
+		 * Sample a Gameplay Message broadcast on an exported channel, queuing a copy of it for writer thread.
+		 * @param ExportedChannelIndex Index of exported channel in settings.
+		 * @param Channel Channel Gameplay Message was broadcast on.
+		 * @param GameplayMessage Gameplay Message.
+		 */
+		void HandleGameplayMessage(const int32 ExportedChannelIndex, const FGameplayTag Channel, const FConstStructView GameplayMessage);
+
+		/**
+		 * Background writer.
+		 */
+		TUniquePtr<FDanzmannGameplayMessagesAnalyticsWriter> Writer;
+
+		/**
+		 * Listeners of exported channels.
+		 */
+		TArray<FDanzmannScopedGameplayMessageListener> Listeners;
+
+		/**
+		 * Sampling rate and accumulator of each exported channel: a Gameplay Message is exported whenever accumulator reaches 1.
+		 */
+		TArray<TPair<float, float>> Samplers;
+
+		/**
+		 * Whether each exported struct type may reference objects, whose paths then have to be captured along with Gameplay Messages.
+		 */
+		TMap<FObjectKey, bool> StructTypesReferencingObjects;
+};
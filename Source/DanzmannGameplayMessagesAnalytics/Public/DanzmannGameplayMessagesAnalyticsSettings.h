@@ -0,0 +1,110 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/DeveloperSettings.h"
+#include "GameplayTagContainer.h"
+
+#include "DanzmannGameplayMessagesAnalyticsSettings.generated.h"
+
+/**
+ * Format Gameplay Messages are exported in.
+ */
+UENUM()
+enum class EDanzmannGameplayMessagesAnalyticsFormat : uint8
+{
+	// One JSON object per line: channel, time, frame and Gameplay Message
+	Json,
+
+	// Records encoded with FDanzmannGameplayMessageCodec, preceded by time and frame
+	Binary
+};
+
+/**
+ * Where exported Gameplay Messages are written.
+ */
+UENUM()
+enum class EDanzmannGameplayMessagesAnalyticsSink : uint8
+{
+	// Rotating files in Saved/Analytics
+	File,
+
+	// Loopback UDP endpoint (e.g., a local collector process)
+	Socket
+};
+
+/**
+ * Channel exported to analytics.
+ */
+USTRUCT()
+struct FDanzmannGameplayMessagesAnalyticsChannel
+{
+	GENERATED_BODY()
+
+	/**
+	 * Channel exported, along with its child channels.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Analytics")
+	FGameplayTag Channel;
+
+	/**
+	 * Fraction of the Gameplay Messages of channel exported (e.g., 0.1 exports one Gameplay Message out of ten).
+	 */
+	UPROPERTY(EditAnywhere, Category = "Analytics", Meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float SamplingRate = 1.0f;
+};
+
+/**
+ * Analytics exporter settings, found in Project Settings > Plugins > Dancing Man Gameplay Messages Analytics.
+ * @see UDanzmannGameplayMessagesAnalyticsExporter.
+ */
+UCLASS(Config = Game, DefaultConfig, DisplayName = "Dancing Man Gameplay Messages Analytics")
+class DANZMANNGAMEPLAYMESSAGESANALYTICS_API UDanzmannGameplayMessagesAnalyticsSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+	public:
+		UDanzmannGameplayMessagesAnalyticsSettings();
+
+		/**
+		 * Whether exporter is enabled.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Analytics")
+		bool bEnabled = false;
+
+		/**
+		 * Channels exported, with their sampling rate.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Analytics")
+		TArray<FDanzmannGameplayMessagesAnalyticsChannel> ExportedChannels;
+
+		/**
+		 * Format Gameplay Messages are exported in.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Analytics")
+		EDanzmannGameplayMessagesAnalyticsFormat Format = EDanzmannGameplayMessagesAnalyticsFormat::Json;
+
+		/**
+		 * Where exported Gameplay Messages are written.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Analytics")
+		EDanzmannGameplayMessagesAnalyticsSink Sink = EDanzmannGameplayMessagesAnalyticsSink::File;
+
+		/**
+		 * Size files are rotated at, in megabytes.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Analytics", Meta = (ClampMin = 1, EditCondition = "Sink == EDanzmannGameplayMessagesAnalyticsSink::File"))
+		int32 MaxFileSizeMB = 64;
+
+		/**
+		 * Loopback endpoint exported Gameplay Messages are sent to (e.g., 127.0.0.1:7790).
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Analytics", Meta = (EditCondition = "Sink == EDanzmannGameplayMessagesAnalyticsSink::Socket"))
+		FString SinkEndpoint = TEXT("127.0.0.1:7790");
+
+		/**
+		 * How often exported Gameplay Messages are written, in seconds.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Analytics", Meta = (ClampMin = "0.01", ForceUnits = "s"))
+		float FlushInterval = 1.0f;
+};
@@ -0,0 +1,190 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Queue.h"
+#include "DanzmannGameplayMessagePayload.h"
+#include "DanzmannGameplayMessagesAnalyticsSettings.h"
+#include "GameplayTagContainer.h"
+#include "HAL/Event.h"
+#include "HAL/Runnable.h"
+#include "UObject/WeakObjectPtr.h"
+
+#include <atomic>
+
+class FArchive;
+class FInternetAddr;
+class FRunnableThread;
+class FSocket;
+
+/**
+ * Gameplay Message waiting to be exported.
+ */
+struct FDanzmannGameplayMessagesAnalyticsRecord
+{
+	/**
+	 * Channel Gameplay Message was broadcast on.
+	 */
+	FGameplayTag Channel;
+
+	/**
+	 * World time Gameplay Message was broadcast at.
+	 */
+	double Time = 0.0;
+
+	/**
+	 * Frame Gameplay Message was broadcast on.
+	 */
+	uint64 Frame = 0;
+
+	/**
+	 * Copy of Gameplay Message.
+	 */
+	FDanzmannGameplayMessagePayloadHandle Payload;
+
+	/**
+	 * Paths of objects referenced by Gameplay Message, captured on the game thread and keyed by the reference found in Payload,
+	 * so writer thread exports them without ever resolving an object.
+	 */
+	TArray<TPair<UPTRINT, FString>> ObjectPaths;
+	TArray<TPair<FWeakObjectPtr, FString>> WeakObjectPaths;
+
+	/**
+	 * Find path captured for an object referenced by Gameplay Message.
+	 * @param Object Object reference found in Payload, never dereferenced.
+	 * @return Object path, nullptr if reference is null or wasn't captured.
+	 */
+	const FString* FindObjectPath(const UPTRINT Object) const
+	{
+		const TPair<UPTRINT, FString>* ObjectPath = ObjectPaths.FindByPredicate(
+			[Object]
+			(const TPair<UPTRINT, FString>& Other)
+			{
+				return Other.Key == Object;
+			}
+		);
+
+		return ObjectPath != nullptr ? &ObjectPath->Value : nullptr;
+	}
+
+	/**
+	 * Find path captured for an object weakly referenced by Gameplay Message.
+	 * @param Object Weak object reference found in Payload, never resolved.
+	 * @return Object path, nullptr if reference is null or wasn't captured.
+	 */
+	const FString* FindObjectPath(const FWeakObjectPtr& Object) const
+	{
+		const TPair<FWeakObjectPtr, FString>* ObjectPath = WeakObjectPaths.FindByPredicate(
+			[&Object]
+			(const TPair<FWeakObjectPtr, FString>& Other)
+			{
+				return Other.Key.HasSameIndexAndSerialNumber(Object);
+			}
+		);
+
+		return ObjectPath != nullptr ? &ObjectPath->Value : nullptr;
+	}
+};
+
+/**
+ * Background writer of exported Gameplay Messages. The game thread only pushes records into a lock-free queue,
+ * while the writer thread serializes them and writes them to its sink, so neither formatting nor I/O ever happens on the game thread.
+ * Object references are exported from the paths captured in each record, writer thread never resolves them, so garbage collection never waits for it.
+ * @see UDanzmannGameplayMessagesAnalyticsExporter.
+ */
+class DANZMANNGAMEPLAYMESSAGESANALYTICS_API FDanzmannGameplayMessagesAnalyticsWriter : public FRunnable, public FNoncopyable
+{
+	public:
+		/**
+		 * Start writer thread.
+		 * @param Settings Settings writer is configured from.
+		 * @param InBaseFilename Base name of the files written, without extension.
+		 */
+		FDanzmannGameplayMessagesAnalyticsWriter(const UDanzmannGameplayMessagesAnalyticsSettings& Settings, const FString& InBaseFilename);
+
+		/**
+		 * Write every record left and stop writer thread.
+		 */
+		virtual ~FDanzmannGameplayMessagesAnalyticsWriter() override;
+
+		/**
+		 * Queue a record to be exported. Only meant to be called from the game thread.
+		 * @param Record Record to export.
+		 */
+		void Enqueue(FDanzmannGameplayMessagesAnalyticsRecord&& Record);
+
+		/**
+		 * @see more info in FRunnable.
+		 */
+		virtual uint32 Run() override;
+
+		/**
+		 * @see more info in FRunnable.
+		 */
+		virtual void Stop() override;
+
+	private:
+		/**
+		 * Serialize every queued record. Called from writer thread.
+		 */
+		void SerializeRecords();
+
+		/**
+		 * Write serialized records to sink. Called from writer thread.
+		 */
+		void WriteSerializedRecords();
+
+		/**
+		 * Open next file, closing current one. Called from writer thread.
+		 */
+		void OpenNextFile();
+
+		/**
+		 * Records waiting to be serialized, pushed by the game thread and popped by writer thread.
+		 */
+		TQueue<FDanzmannGameplayMessagesAnalyticsRecord, EQueueMode::Spsc> Records;
+
+		/**
+		 * Whether writer thread has been asked to stop.
+		 */
+		std::atomic<bool> bIsStopping = false;
+
+		/**
+		 * Triggered to wake writer thread up before its flush interval.
+		 */
+		FEventRef WakeUpEvent;
+
+		/**
+		 * Writer thread.
+		 */
+		TUniquePtr<FRunnableThread> Thread;
+
+		/**
+		 * Settings, copied when writer is created.
+		 */
+		EDanzmannGameplayMessagesAnalyticsFormat Format = EDanzmannGameplayMessagesAnalyticsFormat::Json;
+		EDanzmannGameplayMessagesAnalyticsSink Sink = EDanzmannGameplayMessagesAnalyticsSink::File;
+		int64 MaxFileSize = 0;
+		uint32 FlushIntervalMs = 0;
+		FString BaseFilename;
+
+		/**
+		 * Serialized records waiting to be written, and where each of them ends. Only used by writer thread.
+		 */
+		TArray<uint8> SerializedRecords;
+		TArray<int32> SerializedRecordEnds;
+
+		/**
+		 * Current file, its size, number of records and index. Only used by writer thread.
+		 */
+		TUniquePtr<FArchive> File;
+		int64 FileSize = 0;
+		int32 NumFileRecords = 0;
+		int32 FileIndex = 0;
+
+		/**
+		 * Socket and address of sink. Only used by writer thread.
+		 */
+		FSocket* Socket = nullptr;
+		TSharedPtr<FInternetAddr> SinkAddress;
+};
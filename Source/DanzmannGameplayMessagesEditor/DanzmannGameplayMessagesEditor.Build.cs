@@ -0,0 +1,32 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class DanzmannGameplayMessagesEditor : ModuleRules
+{
+	public DanzmannGameplayMessagesEditor(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"Engine",
+				"GameplayTags"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"AssetRegistry",
+				"BlueprintGraph",
+				"CoreUObject",
+				"DanzmannGameplayMessages",
+				"DeveloperToolSettings",
+				"UnrealEd"
+			}
+		);
+	}
+}
@@ -0,0 +1,17 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesEditor.h"
+
+#define LOCTEXT_NAMESPACE "FDanzmannGameplayMessagesEditorModule"
+
+void FDanzmannGameplayMessagesEditorModule::StartupModule()
+{
+}
+
+void FDanzmannGameplayMessagesEditorModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+	
+IMPLEMENT_MODULE(FDanzmannGameplayMessagesEditorModule, DanzmannGameplayMessagesEditor)
@@ -0,0 +1,226 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesManifestCommandlet.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "DanzmannGameplayMessagesChannelManifest.h"
+#include "DanzmannGameplayMessagesGameInstanceSubsystem.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_CallFunction.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Settings/ProjectPackagingSettings.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDanzmannGameplayMessagesManifest, Log, All);
+
+namespace DanzmannGameplayMessagesManifest
+{
+	/**
+	 * Get channel set as literal on a node pin.
+	 * @param Node Node to get channel from.
+	 * @return Channel, invalid if pin is linked or not set.
+	 */
+	static FGameplayTag GetLiteralChannel(const UK2Node_CallFunction* Node)
+	{
+		const UEdGraphPin* ChannelPin = Node->FindPin(TEXT("Channel"));
+		if ((ChannelPin == nullptr) || (ChannelPin->LinkedTo.Num() > 0))
+		{
+			return FGameplayTag();
+		}
+
+		FGameplayTag Channel;
+		Channel.FromExportString(ChannelPin->GetDefaultAsString());
+		return Channel;
+	}
+
+	/**
+	 * Get Gameplay Message struct type expected by a listener function, from its second parameter.
+	 * @param Function Listener function.
+	 * @return Gameplay Message struct type, nullptr if function doesn't have the expected signature.
+	 */
+	static const UScriptStruct* GetListenerStructType(const UFunction* Function)
+	{
+		int32 ParameterIndex = 0;
+		for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It, ++ParameterIndex)
+		{
+			if (ParameterIndex == 1)
+			{
+				const FStructProperty* StructProperty = CastField<FStructProperty>(*It);
+				return StructProperty != nullptr ? StructProperty->Struct.Get() : nullptr;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * Make sure channel manifest directory is staged as a non-asset directory, since loose files under content directory aren't staged otherwise.
+	 * @param ChannelManifestDirectory Directory channel manifest is saved to, relative to project content directory.
+	 */
+	static void StageChannelManifestDirectory(const FString& ChannelManifestDirectory)
+	{
+		UProjectPackagingSettings* PackagingSettings = GetMutableDefault<UProjectPackagingSettings>();
+		const bool bIsAlreadyStaged = PackagingSettings->DirectoriesToAlwaysStageAsNonUFS.ContainsByPredicate(
+			[&ChannelManifestDirectory]
+			(const FDirectoryPath& Directory)
+			{
+				return Directory.Path == ChannelManifestDirectory;
+			}
+		);
+
+		if (bIsAlreadyStaged)
+		{
+			return;
+		}
+
+		FDirectoryPath& Directory = PackagingSettings->DirectoriesToAlwaysStageAsNonUFS.AddDefaulted_GetRef();
+		Directory.Path = ChannelManifestDirectory;
+		if (PackagingSettings->TryUpdateDefaultConfigFile())
+		{
+			UE_LOG(LogDanzmannGameplayMessagesManifest, Display, TEXT("Added %s to Additional Non-Asset Directories to Package, so channel manifest is staged."), *ChannelManifestDirectory);
+		}
+		else
+		{
+			UE_LOG(LogDanzmannGameplayMessagesManifest, Warning, TEXT("Failed to add %s to Additional Non-Asset Directories to Package, channel manifest won't be staged until it's added."), *ChannelManifestDirectory);
+		}
+	}
+}
+
+UDanzmannGameplayMessagesManifestCommandlet::UDanzmannGameplayMessagesManifestCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UDanzmannGameplayMessagesManifestCommandlet::Main(const FString& Params)
+{
+	FString OutputPath = FDanzmannGameplayMessagesChannelManifest::GetDefaultPath();
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	TArray<FAssetData> BlueprintAssets;
+	AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), BlueprintAssets, true);
+
+	const FName BroadcastFunctionName = GET_FUNCTION_NAME_CHECKED(UDanzmannGameplayMessagesGameInstanceSubsystem, BP_BroadcastGameplayMessage);
+	const FName RegisterListenerFunctionName = GET_FUNCTION_NAME_CHECKED(UDanzmannGameplayMessagesGameInstanceSubsystem, BP_RegisterListener);
+
+	TMap<FGameplayTag, FDanzmannGameplayMessagesChannelManifest::FEntry> Entries;
+	TMap<FGameplayTag, const UScriptStruct*> StructTypes;
+
+	// Keeps track of the Gameplay Message struct type of a channel, reporting channels used with unrelated types
+	auto RecordStructType =
+		[&StructTypes]
+		(const FGameplayTag Channel, const UScriptStruct* StructType, const UBlueprint* Blueprint)
+		{
+			if (StructType == nullptr)
+			{
+				return;
+			}
+
+			const UScriptStruct*& KnownStructType = StructTypes.FindOrAdd(Channel, StructType);
+			if (KnownStructType->IsChildOf(StructType))
+			{
+				// Keep the most derived type, listeners of a parent type are still compatible with it
+				return;
+			}
+
+			if (StructType->IsChildOf(KnownStructType))
+			{
+				KnownStructType = StructType;
+				return;
+			}
+
+			UE_LOG(LogDanzmannGameplayMessagesManifest, Warning, TEXT("Channel %s is used with unrelated types %s and %s (in %s)."), *Channel.ToString(), *KnownStructType->GetPathName(), *StructType->GetPathName(), *GetPathNameSafe(Blueprint));
+		};
+
+	for (const FAssetData& BlueprintAsset : BlueprintAssets)
+	{
+		UBlueprint* Blueprint = Cast<UBlueprint>(BlueprintAsset.GetAsset());
+		if (Blueprint == nullptr)
+		{
+			continue;
+		}
+
+		TArray<UK2Node_CallFunction*> Nodes;
+		FBlueprintEditorUtils::GetAllNodesOfClass<UK2Node_CallFunction>(Blueprint, Nodes);
+
+		for (const UK2Node_CallFunction* Node : Nodes)
+		{
+			const UFunction* Function = Node->GetTargetFunction();
+			if ((Function == nullptr) || !Function->GetOwnerClass()->IsChildOf(UDanzmannGameplayMessagesGameInstanceSubsystem::StaticClass()))
+			{
+				continue;
+			}
+
+			const bool bIsBroadcast = Function->GetFName() == BroadcastFunctionName;
+			const bool bIsRegisterListener = Function->GetFName() == RegisterListenerFunctionName;
+			if (!bIsBroadcast && !bIsRegisterListener)
+			{
+				continue;
+			}
+
+			// Channels computed at runtime can't be known ahead of time
+			const FGameplayTag Channel = DanzmannGameplayMessagesManifest::GetLiteralChannel(Node);
+			if (!Channel.IsValid())
+			{
+				continue;
+			}
+
+			FDanzmannGameplayMessagesChannelManifest::FEntry& Entry = Entries.FindOrAdd(Channel);
+			Entry.Channel = Channel.GetTagName();
+
+			if (bIsBroadcast)
+			{
+				Entry.NumBroadcasters++;
+
+				// Wildcard pin takes the type of whatever it's connected to
+				const UEdGraphPin* GameplayMessagePin = Node->FindPin(TEXT("GameplayMessage"));
+				RecordStructType(Channel, GameplayMessagePin != nullptr ? Cast<UScriptStruct>(GameplayMessagePin->PinType.PinSubCategoryObject.Get()) : nullptr, Blueprint);
+			}
+			else
+			{
+				Entry.NumListeners++;
+
+				// Listener function can only be resolved when it's called on the Blueprint itself with a literal name
+				const UEdGraphPin* ListenerPin = Node->FindPin(TEXT("Listener"));
+				const UEdGraphPin* FunctionNamePin = Node->FindPin(TEXT("FunctionName"));
+				if ((ListenerPin != nullptr) && (ListenerPin->LinkedTo.Num() == 0) && (FunctionNamePin != nullptr) && (FunctionNamePin->LinkedTo.Num() == 0) && (Blueprint->GeneratedClass != nullptr))
+				{
+					if (const UFunction* ListenerFunction = Blueprint->GeneratedClass->FindFunctionByName(FName(*FunctionNamePin->GetDefaultAsString())))
+					{
+						RecordStructType(Channel, DanzmannGameplayMessagesManifest::GetListenerStructType(ListenerFunction), Blueprint);
+					}
+				}
+			}
+		}
+	}
+
+	FDanzmannGameplayMessagesChannelManifest Manifest;
+	Manifest.Entries.Reserve(Entries.Num());
+	for (TPair<FGameplayTag, FDanzmannGameplayMessagesChannelManifest::FEntry>& Pair : Entries)
+	{
+		if (const UScriptStruct* const* StructType = StructTypes.Find(Pair.Key))
+		{
+			Pair.Value.GameplayMessageStructPath = (*StructType)->GetPathName();
+		}
+
+		Manifest.Entries.Add(MoveTemp(Pair.Value));
+	}
+
+	if (!Manifest.Save(OutputPath))
+	{
+		return 1;
+	}
+
+	UE_LOG(LogDanzmannGameplayMessagesManifest, Display, TEXT("Saved %d channels found in %d Blueprints to %s."), Manifest.Entries.Num(), BlueprintAssets.Num(), *OutputPath);
+
+	// Only the default channel manifest is loaded by the subsystem, anything else is up to the caller to stage
+	if (OutputPath == FDanzmannGameplayMessagesChannelManifest::GetDefaultPath())
+	{
+		DanzmannGameplayMessagesManifest::StageChannelManifestDirectory(FDanzmannGameplayMessagesChannelManifest::GetDefaultDirectory());
+	}
+
+	return 0;
+}
@@ -0,0 +1,29 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "DanzmannGameplayMessagesManifestCommandlet.generated.h"
+
+/**
+ * Commandlet generating the channel manifest loaded by Gameplay Messages subsystem at startup. Meant to be run before cooking.
+ * Every Blueprint is scanned for broadcast and listener registration nodes with a literal channel, to find out which Gameplay Message
+ * struct type each channel uses and how many listeners it has.
+ * @note Usage example:
+ *       UnrealEditor-Cmd.exe MyProject.uproject -run=DanzmannGameplayMessagesManifest [-Output=Path/To/ChannelManifest.bin]
+ * @see FDanzmannGameplayMessagesChannelManifest.
+ */
+UCLASS()
+class UDanzmannGameplayMessagesManifestCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+	public:
+		UDanzmannGameplayMessagesManifestCommandlet();
+
+		/**
+		 * @see more info in UCommandlet.
+		 */
+		virtual int32 Main(const FString& Params) override;
+};
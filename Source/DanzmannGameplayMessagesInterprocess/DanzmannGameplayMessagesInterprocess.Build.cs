@@ -0,0 +1,31 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class DanzmannGameplayMessagesInterprocess : ModuleRules
+{
+	public DanzmannGameplayMessagesInterprocess(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"DanzmannGameplayMessages",
+				"DeveloperSettings",
+				"Engine",
+				"GameplayTags"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"Networking",
+				"Sockets"
+			}
+		);
+	}
+}
@@ -0,0 +1,17 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesInterprocess.h"
+
+#define LOCTEXT_NAMESPACE "FDanzmannGameplayMessagesInterprocessModule"
+
+void FDanzmannGameplayMessagesInterprocessModule::StartupModule()
+{
+}
+
+void FDanzmannGameplayMessagesInterprocessModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+	
+IMPLEMENT_MODULE(FDanzmannGameplayMessagesInterprocessModule, DanzmannGameplayMessagesInterprocess)
@@ -0,0 +1,277 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesInterprocessBridge.h"
+#include "Common/UdpSocketBuilder.h"
+#include "DanzmannGameplayMessagesGameInstanceSubsystem.h"
+#include "DanzmannGameplayMessagesInterprocessSettings.h"
+#include "Engine/World.h"
+#include "HAL/PlatformProcess.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDanzmannGameplayMessagesInterprocess, Log, All);
+
+namespace DanzmannGameplayMessages::Private
+{
+	/**
+	 * Batch identifier and version.
+	 */
+	static constexpr uint32 BatchMagic = 0x44474D42;
+	static constexpr int32 BatchVersion = 1;
+
+	/**
+	 * Batch header: identifier, version, sender process ID and number of Gameplay Messages.
+	 */
+	static constexpr int32 BatchHeaderSize = sizeof(uint32) + sizeof(int32) + sizeof(uint32) + sizeof(int32);
+
+	/**
+	 * Biggest UDP datagram payload.
+	 */
+	static constexpr int32 MaxDatagramSize = 65507;
+
+	/**
+	 * Bridge bound to the configured listen port in this process, if any. Only one can be (e.g., with several PIE instances in the same editor).
+	 */
+	static const UDanzmannGameplayMessagesInterprocessBridge* GListeningBridge = nullptr;
+}
+
+bool UDanzmannGameplayMessagesInterprocessBridge::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer) && GetDefault<UDanzmannGameplayMessagesInterprocessSettings>()->bEnabled;
+}
+
+void UDanzmannGameplayMessagesInterprocessBridge::PostInitialize()
+{
+	Super::PostInitialize();
+
+	const UDanzmannGameplayMessagesInterprocessSettings* Settings = GetDefault<UDanzmannGameplayMessagesInterprocessSettings>();
+	ReceivedChannels = Settings->ReceivedChannels;
+	MaxBatchSize = FMath::Clamp(Settings->MaxBatchSize, 1024, DanzmannGameplayMessages::Private::MaxDatagramSize);
+
+	// Only the first bridge of this process listens on the configured port, any other one (e.g., of another PIE instance) would fail to bind it
+	const bool bIsListening = (Settings->ListenPort != 0) && (DanzmannGameplayMessages::Private::GListeningBridge == nullptr);
+	if ((Settings->ListenPort != 0) && !bIsListening)
+	{
+		UE_LOG(LogDanzmannGameplayMessagesInterprocess, Log, TEXT("[%hs] Port %d is already listened on by the interprocess bridge of %s, bridge of %s only sends Gameplay Messages."), __FUNCTION__, Settings->ListenPort, *GetPathNameSafe(DanzmannGameplayMessages::Private::GListeningBridge->GetWorld()), *GetPathNameSafe(GetWorld()));
+	}
+
+	// Loopback only, other machines can't reach the bridge. Port 0 gets an ephemeral port, which is enough to send
+	const FIPv4Endpoint Endpoint(FIPv4Address::InternalLoopback, bIsListening ? static_cast<uint16>(Settings->ListenPort) : 0);
+	Socket = FUdpSocketBuilder(TEXT("DanzmannGameplayMessagesInterprocessBridge"))
+		.AsNonBlocking()
+		.BoundToEndpoint(Endpoint)
+		.WithReceiveBufferSize(4 * DanzmannGameplayMessages::Private::MaxDatagramSize)
+		.WithSendBufferSize(4 * DanzmannGameplayMessages::Private::MaxDatagramSize)
+		.Build();
+
+	if (Socket == nullptr)
+	{
+		UE_LOG(LogDanzmannGameplayMessagesInterprocess, Error, TEXT("[%hs] Failed to bind interprocess bridge to %s, Gameplay Messages aren't mirrored."), __FUNCTION__, *Endpoint.ToString());
+		return;
+	}
+
+	if (bIsListening)
+	{
+		DanzmannGameplayMessages::Private::GListeningBridge = this;
+	}
+
+	for (const FString& PeerEndpoint : Settings->PeerEndpoints)
+	{
+		FIPv4Endpoint PeerIPv4Endpoint;
+		if (FIPv4Endpoint::Parse(PeerEndpoint, PeerIPv4Endpoint))
+		{
+			PeerAddresses.Add(PeerIPv4Endpoint.ToInternetAddr());
+		}
+		else
+		{
+			UE_LOG(LogDanzmannGameplayMessagesInterprocess, Warning, TEXT("[%hs] Peer endpoint %s is not valid, it's ignored."), __FUNCTION__, *PeerEndpoint);
+		}
+	}
+
+	// Routers are created when worlds are initialized, so the one of this world is around by now
+	const UWorld* World = GetWorld();
+	if (PeerAddresses.IsEmpty() || Settings->SentChannels.IsEmpty() || !UDanzmannGameplayMessagesGameInstanceSubsystem::HasInstance(World))
+	{
+		return;
+	}
+
+	UDanzmannGameplayMessagesGameInstanceSubsystem* GameplayMessagesSubsystem = UDanzmannGameplayMessagesGameInstanceSubsystem::Get(World);
+	for (const FGameplayTag& Channel : Settings->SentChannels)
+	{
+		Listeners.Emplace(GameplayMessagesSubsystem, GameplayMessagesSubsystem->RegisterListener(Channel, nullptr,
+			[this](const FGameplayTag ReceivedChannel, const FConstStructView GameplayMessage)
+			{
+				HandleGameplayMessage(ReceivedChannel, GameplayMessage);
+			},
+			EDanzmannGameplayMessagesMatchCriteria::PartialMatch
+		));
+	}
+}
+
+void UDanzmannGameplayMessagesInterprocessBridge::Deinitialize()
+{
+	Listeners.Reset();
+
+	if (DanzmannGameplayMessages::Private::GListeningBridge == this)
+	{
+		DanzmannGameplayMessages::Private::GListeningBridge = nullptr;
+	}
+
+	if (Socket != nullptr)
+	{
+		// Gameplay Messages of the last frame still get out
+		SendPendingBatch();
+
+		Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+		Socket = nullptr;
+	}
+
+	PeerAddresses.Reset();
+
+	Super::Deinitialize();
+}
+
+void UDanzmannGameplayMessagesInterprocessBridge::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Socket == nullptr)
+	{
+		return;
+	}
+
+	ReceiveBatches();
+	SendPendingBatch();
+}
+
+TStatId UDanzmannGameplayMessagesInterprocessBridge::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDanzmannGameplayMessagesInterprocessBridge, STATGROUP_Tickables);
+}
+
+bool UDanzmannGameplayMessagesInterprocessBridge::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return (WorldType == EWorldType::Game) || (WorldType == EWorldType::PIE);
+}
+
+void UDanzmannGameplayMessagesInterprocessBridge::HandleGameplayMessage(const FGameplayTag Channel, const FConstStructView GameplayMessage)
+{
+	// Gameplay Message received from a peer, sending it back would bounce it between processes forever
+	if ((GameplayMessage.GetMemory() == ReceivedGameplayMessage) || (Socket == nullptr) || (GameplayMessage.GetScriptStruct() == nullptr))
+	{
+		return;
+	}
+
+	EncodedGameplayMessage.Reset();
+	FMemoryWriter Writer(EncodedGameplayMessage, true);
+	if (!FDanzmannGameplayMessageCodec::Encode(Writer, Channel, GameplayMessage))
+	{
+		return;
+	}
+
+	if ((DanzmannGameplayMessages::Private::BatchHeaderSize + EncodedGameplayMessage.Num()) > MaxBatchSize)
+	{
+		UE_LOG(LogDanzmannGameplayMessagesInterprocess, Warning, TEXT("[%hs] Gameplay Message on channel %s doesn't fit in a batch (%d bytes), it's not mirrored."), __FUNCTION__, *Channel.ToString(), EncodedGameplayMessage.Num());
+		return;
+	}
+
+	// Batches are sent once per frame, unless they're full
+	if ((PendingBatch.Num() + EncodedGameplayMessage.Num()) > MaxBatchSize)
+	{
+		SendPendingBatch();
+	}
+
+	if (PendingBatch.IsEmpty())
+	{
+		PendingBatch.AddZeroed(DanzmannGameplayMessages::Private::BatchHeaderSize);
+	}
+
+	PendingBatch.Append(EncodedGameplayMessage);
+	++NumPendingGameplayMessages;
+}
+
+void UDanzmannGameplayMessagesInterprocessBridge::SendPendingBatch()
+{
+	if (NumPendingGameplayMessages == 0)
+	{
+		return;
+	}
+
+	// Header is written last, once number of Gameplay Messages is known
+	FMemoryWriter HeaderWriter(PendingBatch, true);
+	uint32 Magic = DanzmannGameplayMessages::Private::BatchMagic;
+	int32 Version = DanzmannGameplayMessages::Private::BatchVersion;
+	uint32 ProcessId = FPlatformProcess::GetCurrentProcessId();
+	HeaderWriter << Magic << Version << ProcessId << NumPendingGameplayMessages;
+
+	for (const TSharedRef<FInternetAddr>& PeerAddress : PeerAddresses)
+	{
+		int32 BytesSent = 0;
+		if (!Socket->SendTo(PendingBatch.GetData(), PendingBatch.Num(), BytesSent, *PeerAddress))
+		{
+			UE_LOG(LogDanzmannGameplayMessagesInterprocess, Verbose, TEXT("[%hs] Failed to send batch of %d Gameplay Messages to %s."), __FUNCTION__, NumPendingGameplayMessages, *PeerAddress->ToString(true));
+		}
+	}
+
+	PendingBatch.Reset();
+	NumPendingGameplayMessages = 0;
+}
+
+void UDanzmannGameplayMessagesInterprocessBridge::ReceiveBatches()
+{
+	const UWorld* World = GetWorld();
+	if (!UDanzmannGameplayMessagesGameInstanceSubsystem::HasInstance(World))
+	{
+		return;
+	}
+
+	UDanzmannGameplayMessagesGameInstanceSubsystem* GameplayMessagesSubsystem = UDanzmannGameplayMessagesGameInstanceSubsystem::Get(World);
+	const TSharedRef<FInternetAddr> SenderAddress = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+	const uint32 CurrentProcessId = FPlatformProcess::GetCurrentProcessId();
+
+	uint32 PendingDataSize = 0;
+	while (Socket->HasPendingData(PendingDataSize))
+	{
+		ReceivedBatch.SetNumUninitialized(DanzmannGameplayMessages::Private::MaxDatagramSize, EAllowShrinking::No);
+
+		int32 BytesRead = 0;
+		if (!Socket->RecvFrom(ReceivedBatch.GetData(), ReceivedBatch.Num(), BytesRead, *SenderAddress))
+		{
+			break;
+		}
+
+		if (BytesRead < DanzmannGameplayMessages::Private::BatchHeaderSize)
+		{
+			continue;
+		}
+
+		FMemoryReaderView Reader(MakeArrayView(ReceivedBatch.GetData(), BytesRead), true);
+		uint32 Magic = 0;
+		int32 Version = 0;
+		uint32 ProcessId = 0;
+		int32 NumGameplayMessages = 0;
+		Reader << Magic << Version << ProcessId << NumGameplayMessages;
+
+		// Batches of other builds or sent by this very process (e.g., listed as its own peer) are dropped
+		if ((Magic != DanzmannGameplayMessages::Private::BatchMagic) || (Version != DanzmannGameplayMessages::Private::BatchVersion) || (ProcessId == CurrentProcessId))
+		{
+			continue;
+		}
+
+		for (int32 Index = 0; (Index < NumGameplayMessages) && !Reader.IsError() && !Reader.AtEnd(); ++Index)
+		{
+			FGameplayTag Channel;
+			FInstancedStruct GameplayMessage;
+			if (Codec.Decode(Reader, Channel, GameplayMessage) && Channel.MatchesAny(ReceivedChannels))
+			{
+				// Any other Gameplay Message broadcast meanwhile (e.g., by a listener reacting to this one) is sent as usual
+				TGuardValue<const void*> ReceivedGameplayMessageGuard(ReceivedGameplayMessage, GameplayMessage.GetMemory());
+				GameplayMessagesSubsystem->BroadcastGameplayMessage(Channel, FConstStructView(GameplayMessage));
+			}
+		}
+	}
+}
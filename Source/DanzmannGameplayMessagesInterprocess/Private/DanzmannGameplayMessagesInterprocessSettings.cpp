@@ -0,0 +1,9 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesInterprocessSettings.h"
+
+UDanzmannGameplayMessagesInterprocessSettings::UDanzmannGameplayMessagesInterprocessSettings()
+{
+	CategoryName = TEXT("Plugins");
+	SectionName = TEXT("DanzmannGameplayMessagesInterprocess");
+}
@@ -0,0 +1,131 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "DanzmannGameplayMessageCodec.h"
+#include "DanzmannScopedGameplayMessageListener.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "DanzmannGameplayMessagesInterprocessBridge.generated.h"
+
+class FInternetAddr;
+class FSocket;
+
+/**
+ * Bridge mirroring Gameplay Messages between processes running on the same machine (e.g., match shards, lobby, bot controllers), over loopback UDP.
+ * Gameplay Messages broadcast on sent channels are encoded with FDanzmannGameplayMessageCodec and batched, each batch being a single datagram
+ * sent to every peer once per frame. Gameplay Messages received from peers on received channels are decoded and broadcast locally,
+ * and never sent back. Delivery is best effort: batches lost or received out of order aren't sent again.
+ * @see UDanzmannGameplayMessagesInterprocessSettings.
+ * @note Native Gameplay Messages have no reflection data, they're not mirrored.
+ */
+UCLASS()
+class DANZMANNGAMEPLAYMESSAGESINTERPROCESS_API UDanzmannGameplayMessagesInterprocessBridge : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+	public:
+		/**
+		 * @see more info in USubsystem.
+		 */
+		virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+		/**
+		 * @see more info in UWorldSubsystem.
+		 */
+		virtual void PostInitialize() override;
+
+		/**
+		 * @see more info in USubsystem.
+		 */
+		virtual void Deinitialize() override;
+
+		/**
+		 * @see more info in FTickableGameObject.
+		 */
+		virtual void Tick(float DeltaTime) override;
+
+		/**
+		 * @see more info in FTickableGameObject.
+		 */
+		virtual TStatId GetStatId() const override;
+
+	protected:
+		/**
+		 * @see more info in UWorldSubsystem.
+		 */
+		virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	private:
+		/**
+		 * Encode a Gameplay Message broadcast on a sent channel into the pending batch.
+		 * @param Channel Channel Gameplay Message was broadcast on.
+		 * @param GameplayMessage Gameplay Message.
+		 */
+		void HandleGameplayMessage(const FGameplayTag Channel, const FConstStructView GameplayMessage);
+
+		/**
+		 * Send pending batch to every peer.
+		 */
+		void SendPendingBatch();
+
+		/**
+		 * Decode every batch received since last frame and broadcast its Gameplay Messages.
+		 */
+		void ReceiveBatches();
+
+		/**
+		 * Loopback socket batches are sent from and received on.
+		 */
+		FSocket* Socket = nullptr;
+
+		/**
+		 * Addresses of peers.
+		 */
+		TArray<TSharedRef<FInternetAddr>> PeerAddresses;
+
+		/**
+		 * Listeners of sent channels.
+		 */
+		TArray<FDanzmannScopedGameplayMessageListener> Listeners;
+
+		/**
+		 * Channels whose received Gameplay Messages are broadcast, copied from settings.
+		 */
+		FGameplayTagContainer ReceivedChannels;
+
+		/**
+		 * Decoder of received batches, caching resolved struct types.
+		 */
+		FDanzmannGameplayMessageCodec Codec;
+
+		/**
+		 * Batch being filled, starting with its header.
+		 */
+		TArray<uint8> PendingBatch;
+
+		/**
+		 * Number of Gameplay Messages in pending batch.
+		 */
+		int32 NumPendingGameplayMessages = 0;
+
+		/**
+		 * Scratch buffer a Gameplay Message is encoded into before being added to pending batch, reused from one Gameplay Message to the next.
+		 */
+		TArray<uint8> EncodedGameplayMessage;
+
+		/**
+		 * Buffer batches are received into.
+		 */
+		TArray<uint8> ReceivedBatch;
+
+		/**
+		 * Biggest batch size, copied from settings.
+		 */
+		int32 MaxBatchSize = 0;
+
+		/**
+		 * Origin marker: Gameplay Message received from a peer being broadcast, if any. It's never sent back.
+		 */
+		const void* ReceivedGameplayMessage = nullptr;
+};
@@ -0,0 +1,58 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/DeveloperSettings.h"
+#include "GameplayTagContainer.h"
+
+#include "DanzmannGameplayMessagesInterprocessSettings.generated.h"
+
+/**
+ * Interprocess bridge settings, found in Project Settings > Plugins > Dancing Man Gameplay Messages Interprocess.
+ * Usually overridden per process from the command line (e.g., -ini:Game:[/Script/DanzmannGameplayMessagesInterprocess.DanzmannGameplayMessagesInterprocessSettings]:ListenPort=7780).
+ * @see UDanzmannGameplayMessagesInterprocessBridge.
+ */
+UCLASS(Config = Game, DefaultConfig, DisplayName = "Dancing Man Gameplay Messages Interprocess")
+class DANZMANNGAMEPLAYMESSAGESINTERPROCESS_API UDanzmannGameplayMessagesInterprocessSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+	public:
+		UDanzmannGameplayMessagesInterprocessSettings();
+
+		/**
+		 * Whether bridge is enabled.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Bridge")
+		bool bEnabled = false;
+
+		/**
+		 * Loopback port Gameplay Messages are received on, 0 to only send them. Only the first world of a process listens on it, the others only send.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Bridge", Meta = (ClampMin = 0, ClampMax = 65535))
+		int32 ListenPort = 0;
+
+		/**
+		 * Endpoints of the peer processes Gameplay Messages are sent to (e.g., 127.0.0.1:7780).
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Bridge")
+		TArray<FString> PeerEndpoints;
+
+		/**
+		 * Channels whose Gameplay Messages are sent to peers, along with their child channels.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Bridge")
+		FGameplayTagContainer SentChannels;
+
+		/**
+		 * Channels whose Gameplay Messages received from peers are broadcast locally, along with their child channels.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Bridge")
+		FGameplayTagContainer ReceivedChannels;
+
+		/**
+		 * Biggest batch of Gameplay Messages sent at once, in bytes. Gameplay Messages of a frame that don't fit are sent in several batches.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Bridge", Meta = (ClampMin = 1024, ClampMax = 65507))
+		int32 MaxBatchSize = 60000;
+};
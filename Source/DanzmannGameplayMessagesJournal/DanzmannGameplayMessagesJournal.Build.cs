@@ -0,0 +1,23 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class DanzmannGameplayMessagesJournal : ModuleRules
+{
+	public DanzmannGameplayMessagesJournal(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"DanzmannGameplayMessages",
+				"DeveloperSettings",
+				"Engine",
+				"GameplayTags"
+			}
+		);
+	}
+}
@@ -0,0 +1,17 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesJournal.h"
+
+#define LOCTEXT_NAMESPACE "FDanzmannGameplayMessagesJournalModule"
+
+void FDanzmannGameplayMessagesJournalModule::StartupModule()
+{
+}
+
+void FDanzmannGameplayMessagesJournalModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+	
+IMPLEMENT_MODULE(FDanzmannGameplayMessagesJournalModule, DanzmannGameplayMessagesJournal)
@@ -0,0 +1,96 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesJournalFormat.h"
+#include "UObject/Class.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/UnrealType.h"
+
+namespace DanzmannGameplayMessages::Private
+{
+	/**
+	 * Check whether a struct type can be copied as is between processes: plain old data made of numbers, enums and bools only.
+	 * @param StructType Struct type.
+	 * @return Whether struct type can be encoded raw.
+	 */
+	static bool IsRawEncodable(const UScriptStruct* StructType)
+	{
+		if ((StructType->StructFlags & STRUCT_IsPlainOldData) == 0)
+		{
+			return false;
+		}
+
+		for (TFieldIterator<FProperty> It(StructType); It; ++It)
+		{
+			const FProperty* Property = *It;
+			if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+			{
+				// Bitfields share their bytes with other bitfields, they can't be remapped on their own
+				if (!BoolProperty->IsNativeBool())
+				{
+					return false;
+				}
+			}
+			else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				if (!IsRawEncodable(StructProperty->Struct))
+				{
+					return false;
+				}
+			}
+			else if (!Property->IsA<FNumericProperty>() && !Property->IsA<FEnumProperty>())
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Collect numeric, enum and bool properties of a struct type, flattening nested structs.
+	 * @param StructType Struct type.
+	 * @param Prefix Prefix of property names.
+	 * @param BaseOffset Offset of struct type within Gameplay Message.
+	 * @param OutProperties Properties collected.
+	 */
+	static void CollectJournalProperties(const UScriptStruct* StructType, const FString& Prefix, const int32 BaseOffset, TArray<FDanzmannGameplayMessagesJournalProperty>& OutProperties)
+	{
+		for (TFieldIterator<FProperty> It(StructType); It; ++It)
+		{
+			const FProperty* Property = *It;
+			const FString Name = Prefix + Property->GetName();
+			const int32 Offset = BaseOffset + Property->GetOffset_ForInternal();
+
+			const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+			const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property);
+			if ((StructProperty != nullptr) && (Property->ArrayDim == 1))
+			{
+				CollectJournalProperties(StructProperty->Struct, Name + TEXT("."), Offset, OutProperties);
+			}
+			else if (Property->IsA<FNumericProperty>() || Property->IsA<FEnumProperty>() || ((BoolProperty != nullptr) && BoolProperty->IsNativeBool()))
+			{
+				FDanzmannGameplayMessagesJournalProperty& JournalProperty = OutProperties.AddDefaulted_GetRef();
+				JournalProperty.Name = Name;
+				JournalProperty.CPPType = Property->GetCPPType();
+				JournalProperty.Offset = Offset;
+				JournalProperty.Size = Property->GetSize();
+			}
+		}
+	}
+}
+
+FDanzmannGameplayMessagesJournalSchema FDanzmannGameplayMessagesJournalSchema::Create(const UScriptStruct* StructType)
+{
+	FDanzmannGameplayMessagesJournalSchema Schema;
+	if (StructType == nullptr)
+	{
+		return Schema;
+	}
+
+	Schema.StructPath = StructType->GetPathName();
+	Schema.Encoding = DanzmannGameplayMessages::Private::IsRawEncodable(StructType) ? EDanzmannGameplayMessagesJournalEncoding::Raw : EDanzmannGameplayMessagesJournalEncoding::Tagged;
+	Schema.StructureSize = StructType->GetStructureSize();
+	DanzmannGameplayMessages::Private::CollectJournalProperties(StructType, FString(), 0, Schema.Properties);
+
+	return Schema;
+}
@@ -0,0 +1,294 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesJournalReader.h"
+#include "Algo/BinarySearch.h"
+#include "HAL/FileManager.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/Class.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDanzmannGameplayMessagesJournal, Log, All);
+
+namespace DanzmannGameplayMessages::Private
+{
+	/**
+	 * Record header: world time, frame, channel index, schema index and payload size.
+	 */
+	static constexpr int32 JournalRecordHeaderSize = sizeof(double) + sizeof(uint64) + sizeof(int32) + sizeof(int32) + sizeof(int32);
+
+	/**
+	 * Journal trailer: footer offset and identifier.
+	 */
+	static constexpr int32 JournalTrailerSize = sizeof(int64) + sizeof(uint32);
+}
+
+FDanzmannGameplayMessagesJournalReader::FDanzmannGameplayMessagesJournalReader() = default;
+
+FDanzmannGameplayMessagesJournalReader::~FDanzmannGameplayMessagesJournalReader() = default;
+
+bool FDanzmannGameplayMessagesJournalReader::Open(const FString& Filename)
+{
+	File.Reset(IFileManager::Get().CreateFileReader(*Filename));
+	if (!File.IsValid())
+	{
+		UE_LOG(LogDanzmannGameplayMessagesJournal, Error, TEXT("[%hs] Failed to open journal %s."), __FUNCTION__, *Filename);
+		return false;
+	}
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	FString CompressionFormatName;
+	*File << Magic << Version << CompressionFormatName;
+	if ((Magic != DanzmannGameplayMessages::JournalMagic) || (Version != DanzmannGameplayMessages::JournalVersion) || File->IsError())
+	{
+		UE_LOG(LogDanzmannGameplayMessagesJournal, Error, TEXT("[%hs] %s isn't a journal of this version."), __FUNCTION__, *Filename);
+		File.Reset();
+		return false;
+	}
+	CompressionFormat = FName(*CompressionFormatName);
+
+	// Footer is only written once journal is done, journals of processes that didn't shut down cleanly can't be read
+	const int64 HeaderEndOffset = File->Tell();
+	const int64 TrailerOffset = File->TotalSize() - DanzmannGameplayMessages::Private::JournalTrailerSize;
+	int64 FooterOffset = 0;
+	Magic = 0;
+	if (TrailerOffset >= HeaderEndOffset)
+	{
+		File->Seek(TrailerOffset);
+		*File << FooterOffset << Magic;
+	}
+
+	if ((Magic != DanzmannGameplayMessages::JournalMagic) || File->IsError() || !FMath::IsWithinInclusive(FooterOffset, HeaderEndOffset, TrailerOffset))
+	{
+		UE_LOG(LogDanzmannGameplayMessagesJournal, Error, TEXT("[%hs] Journal %s has no footer, it wasn't finished."), __FUNCTION__, *Filename);
+		File.Reset();
+		return false;
+	}
+
+	TArray<FString> ChannelNames;
+	File->Seek(FooterOffset);
+	*File << Schemas << ChannelNames << Chunks;
+	if (File->IsError())
+	{
+		UE_LOG(LogDanzmannGameplayMessagesJournal, Error, TEXT("[%hs] Footer of journal %s is corrupted."), __FUNCTION__, *Filename);
+		File.Reset();
+		return false;
+	}
+
+	// Channels that no longer exist stay invalid, their records are skipped
+	Channels.Reset(ChannelNames.Num());
+	for (const FString& ChannelName : ChannelNames)
+	{
+		Channels.Add(FGameplayTag::RequestGameplayTag(FName(*ChannelName), false));
+	}
+
+	ResolvedSchemas.Reset();
+	ResolvedSchemas.SetNum(Schemas.Num());
+
+	CurrentChunkIndex = INDEX_NONE;
+	ChunkData.Reset();
+	RecordOffset = 0;
+
+	return Chunks.IsEmpty() || LoadChunk(0);
+}
+
+bool FDanzmannGameplayMessagesJournalReader::SeekToChunk(const int32 ChunkIndex)
+{
+	return File.IsValid() && Chunks.IsValidIndex(ChunkIndex) && LoadChunk(ChunkIndex);
+}
+
+bool FDanzmannGameplayMessagesJournalReader::SeekToTime(const double Time)
+{
+	if (!File.IsValid() || Chunks.IsEmpty())
+	{
+		return false;
+	}
+
+	// Last chunk starting at or before time holds it, unless it's past its last record
+	const int32 ChunkIndex = FMath::Max(Algo::UpperBoundBy(Chunks, Time, &FDanzmannGameplayMessagesJournalChunk::FirstTime) - 1, 0);
+	for (int32 Index = ChunkIndex; Index < Chunks.Num(); ++Index)
+	{
+		if (!LoadChunk(Index))
+		{
+			return false;
+		}
+
+		// Records before time are skipped without decoding their payload
+		while ((RecordOffset + DanzmannGameplayMessages::Private::JournalRecordHeaderSize) <= ChunkData.Num())
+		{
+			double RecordTime = 0.0;
+			FMemoryReaderView Reader(MakeArrayView(ChunkData.GetData() + RecordOffset, DanzmannGameplayMessages::Private::JournalRecordHeaderSize), true);
+			Reader << RecordTime;
+			if (RecordTime >= Time)
+			{
+				return true;
+			}
+
+			int32 PayloadSize = 0;
+			Reader.Seek(DanzmannGameplayMessages::Private::JournalRecordHeaderSize - sizeof(int32));
+			Reader << PayloadSize;
+			RecordOffset += DanzmannGameplayMessages::Private::JournalRecordHeaderSize + FMath::Max(PayloadSize, 0);
+		}
+	}
+
+	return false;
+}
+
+bool FDanzmannGameplayMessagesJournalReader::ReadNext(FDanzmannGameplayMessagesJournalRecord& OutRecord)
+{
+	if (!File.IsValid())
+	{
+		return false;
+	}
+
+	while (true)
+	{
+		if ((RecordOffset + DanzmannGameplayMessages::Private::JournalRecordHeaderSize) > ChunkData.Num())
+		{
+			if (!Chunks.IsValidIndex(CurrentChunkIndex + 1) || !LoadChunk(CurrentChunkIndex + 1))
+			{
+				return false;
+			}
+
+			continue;
+		}
+
+		FMemoryReaderView Reader(MakeArrayView(ChunkData.GetData() + RecordOffset, ChunkData.Num() - RecordOffset), true);
+		int32 ChannelIndex = INDEX_NONE;
+		int32 SchemaIndex = INDEX_NONE;
+		int32 PayloadSize = 0;
+		Reader << OutRecord.Time << OutRecord.Frame << ChannelIndex << SchemaIndex << PayloadSize;
+
+		if ((PayloadSize < 0) || ((DanzmannGameplayMessages::Private::JournalRecordHeaderSize + PayloadSize) > (ChunkData.Num() - RecordOffset)))
+		{
+			UE_LOG(LogDanzmannGameplayMessagesJournal, Error, TEXT("[%hs] Chunk %d is corrupted, skipping the rest of it."), __FUNCTION__, CurrentChunkIndex);
+			RecordOffset = ChunkData.Num();
+			continue;
+		}
+
+		const TConstArrayView<uint8> Payload(ChunkData.GetData() + RecordOffset + DanzmannGameplayMessages::Private::JournalRecordHeaderSize, PayloadSize);
+		RecordOffset += DanzmannGameplayMessages::Private::JournalRecordHeaderSize + PayloadSize;
+
+		OutRecord.Channel = Channels.IsValidIndex(ChannelIndex) ? Channels[ChannelIndex] : FGameplayTag();
+		if (OutRecord.Channel.IsValid() && Schemas.IsValidIndex(SchemaIndex) && DecodePayload(SchemaIndex, Payload, OutRecord.GameplayMessage))
+		{
+			return true;
+		}
+	}
+}
+
+bool FDanzmannGameplayMessagesJournalReader::LoadChunk(const int32 ChunkIndex)
+{
+	const FDanzmannGameplayMessagesJournalChunk& Chunk = Chunks[ChunkIndex];
+	CurrentChunkIndex = ChunkIndex;
+	RecordOffset = 0;
+	ChunkData.Reset();
+
+	if ((Chunk.CompressedSize < 0) || (Chunk.UncompressedSize < 0) || ((Chunk.Offset + Chunk.CompressedSize) > File->TotalSize()))
+	{
+		UE_LOG(LogDanzmannGameplayMessagesJournal, Error, TEXT("[%hs] Chunk %d is out of journal bounds."), __FUNCTION__, ChunkIndex);
+		return false;
+	}
+
+	CompressedData.SetNumUninitialized(Chunk.CompressedSize, EAllowShrinking::No);
+	File->Seek(Chunk.Offset);
+	File->Serialize(CompressedData.GetData(), Chunk.CompressedSize);
+
+	ChunkData.SetNumUninitialized(Chunk.UncompressedSize);
+	if (File->IsError() || !FCompression::UncompressMemory(CompressionFormat, ChunkData.GetData(), Chunk.UncompressedSize, CompressedData.GetData(), Chunk.CompressedSize))
+	{
+		UE_LOG(LogDanzmannGameplayMessagesJournal, Error, TEXT("[%hs] Failed to decompress chunk %d."), __FUNCTION__, ChunkIndex);
+		ChunkData.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+const FDanzmannGameplayMessagesJournalReader::FResolvedSchema& FDanzmannGameplayMessagesJournalReader::ResolveSchema(const int32 SchemaIndex)
+{
+	FResolvedSchema& ResolvedSchema = ResolvedSchemas[SchemaIndex];
+	if (ResolvedSchema.bIsResolved)
+	{
+		return ResolvedSchema;
+	}
+	ResolvedSchema.bIsResolved = true;
+
+	const FDanzmannGameplayMessagesJournalSchema& Schema = Schemas[SchemaIndex];
+	const UScriptStruct* StructType = FindObject<UScriptStruct>(nullptr, *Schema.StructPath);
+	if (StructType == nullptr)
+	{
+		UE_LOG(LogDanzmannGameplayMessagesJournal, Warning, TEXT("[%hs] Struct type %s no longer exists, its Gameplay Messages are skipped."), __FUNCTION__, *Schema.StructPath);
+		return ResolvedSchema;
+	}
+
+	ResolvedSchema.StructType = StructType;
+
+	const FDanzmannGameplayMessagesJournalSchema CurrentSchema = FDanzmannGameplayMessagesJournalSchema::Create(StructType);
+	ResolvedSchema.bHasSameLayout = Schema.HasSameLayout(CurrentSchema);
+	if (ResolvedSchema.bHasSameLayout || (Schema.Encoding != EDanzmannGameplayMessagesJournalEncoding::Raw))
+	{
+		return ResolvedSchema;
+	}
+
+	// Properties that kept their name and type are copied, the ones added since keep their default value
+	for (const FDanzmannGameplayMessagesJournalProperty& Property : Schema.Properties)
+	{
+		const FDanzmannGameplayMessagesJournalProperty* CurrentProperty = CurrentSchema.Properties.FindByPredicate([&Property](const FDanzmannGameplayMessagesJournalProperty& Other)
+		{
+			return (Other.Name == Property.Name) && (Other.CPPType == Property.CPPType) && (Other.Size == Property.Size);
+		});
+
+		if ((CurrentProperty != nullptr) && ((Property.Offset + Property.Size) <= Schema.StructureSize))
+		{
+			ResolvedSchema.RemappedProperties.Emplace(Property.Offset, CurrentProperty->Offset, Property.Size);
+		}
+	}
+
+	UE_LOG(LogDanzmannGameplayMessagesJournal, Log, TEXT("[%hs] Layout of struct type %s changed since journal was recorded, %d of its %d properties are remapped."), __FUNCTION__, *Schema.StructPath, ResolvedSchema.RemappedProperties.Num(), Schema.Properties.Num());
+
+	return ResolvedSchema;
+}
+
+bool FDanzmannGameplayMessagesJournalReader::DecodePayload(const int32 SchemaIndex, const TConstArrayView<uint8> Payload, FInstancedStruct& OutGameplayMessage)
+{
+	const FResolvedSchema& ResolvedSchema = ResolveSchema(SchemaIndex);
+	const UScriptStruct* StructType = ResolvedSchema.StructType.Get();
+	if (StructType == nullptr)
+	{
+		return false;
+	}
+
+	const FDanzmannGameplayMessagesJournalSchema& Schema = Schemas[SchemaIndex];
+	OutGameplayMessage.InitializeAs(StructType);
+	uint8* Memory = OutGameplayMessage.GetMutableMemory();
+
+	if (Schema.Encoding == EDanzmannGameplayMessagesJournalEncoding::Tagged)
+	{
+		FMemoryReaderView Reader(Payload, true);
+		FObjectAndNameAsStringProxyArchive ProxyReader(Reader, false);
+		StructType->SerializeItem(ProxyReader, Memory, nullptr);
+
+		return !Reader.IsError();
+	}
+
+	if (Payload.Num() < Schema.StructureSize)
+	{
+		return false;
+	}
+
+	if (ResolvedSchema.bHasSameLayout)
+	{
+		FMemory::Memcpy(Memory, Payload.GetData(), Schema.StructureSize);
+	}
+	else
+	{
+		for (const FIntVector3& RemappedProperty : ResolvedSchema.RemappedProperties)
+		{
+			FMemory::Memcpy(Memory + RemappedProperty.Y, Payload.GetData() + RemappedProperty.X, RemappedProperty.Z);
+		}
+	}
+
+	return true;
+}
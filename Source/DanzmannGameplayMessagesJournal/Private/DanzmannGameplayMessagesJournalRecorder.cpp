@@ -0,0 +1,70 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesJournalRecorder.h"
+#include "DanzmannGameplayMessagesGameInstanceSubsystem.h"
+#include "DanzmannGameplayMessagesJournalSettings.h"
+#include "Engine/World.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+
+bool UDanzmannGameplayMessagesJournalRecorder::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UDanzmannGameplayMessagesJournalSettings* Settings = GetDefault<UDanzmannGameplayMessagesJournalSettings>();
+	return Super::ShouldCreateSubsystem(Outer) && Settings->bEnabled && !Settings->RecordedChannels.IsEmpty();
+}
+
+void UDanzmannGameplayMessagesJournalRecorder::PostInitialize()
+{
+	Super::PostInitialize();
+
+	// Routers are created when worlds are initialized, so the one of this world is around by now
+	const UWorld* World = GetWorld();
+	if (!UDanzmannGameplayMessagesGameInstanceSubsystem::HasInstance(World))
+	{
+		return;
+	}
+
+	const UDanzmannGameplayMessagesJournalSettings* Settings = GetDefault<UDanzmannGameplayMessagesJournalSettings>();
+	const FString Filename = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Journals"), FString::Printf(TEXT("GameplayMessages_%s_%s.dgmj"), *World->GetMapName(), *FDateTime::Now().ToString()));
+	Writer = MakeUnique<FDanzmannGameplayMessagesJournalWriter>(Filename, Settings->ChunkSizeKB * 1024, Settings->CompressionFormat);
+	if (!Writer->IsValid())
+	{
+		Writer.Reset();
+		return;
+	}
+
+	UDanzmannGameplayMessagesGameInstanceSubsystem* GameplayMessagesSubsystem = UDanzmannGameplayMessagesGameInstanceSubsystem::Get(World);
+	for (const FGameplayTag& Channel : Settings->RecordedChannels)
+	{
+		Listeners.Emplace(GameplayMessagesSubsystem, GameplayMessagesSubsystem->RegisterListener(Channel, nullptr,
+			[this](const FGameplayTag ReceivedChannel, const FConstStructView GameplayMessage)
+			{
+				HandleGameplayMessage(ReceivedChannel, GameplayMessage);
+			},
+			EDanzmannGameplayMessagesMatchCriteria::PartialMatch
+		));
+	}
+}
+
+void UDanzmannGameplayMessagesJournalRecorder::Deinitialize()
+{
+	Listeners.Reset();
+
+	// Writer compresses every chunk left and writes footer before it's done
+	Writer.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UDanzmannGameplayMessagesJournalRecorder::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return (WorldType == EWorldType::Game) || (WorldType == EWorldType::PIE);
+}
+
+void UDanzmannGameplayMessagesJournalRecorder::HandleGameplayMessage(const FGameplayTag Channel, const FConstStructView GameplayMessage)
+{
+	if (Writer.IsValid())
+	{
+		Writer->Write(GetWorld()->GetTimeSeconds(), GFrameCounter, Channel, GameplayMessage);
+	}
+}
@@ -0,0 +1,9 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesJournalSettings.h"
+
+UDanzmannGameplayMessagesJournalSettings::UDanzmannGameplayMessagesJournalSettings()
+{
+	CategoryName = TEXT("Plugins");
+	SectionName = TEXT("DanzmannGameplayMessagesJournal");
+}
@@ -0,0 +1,216 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#include "DanzmannGameplayMessagesJournalWriter.h"
+#include "HAL/FileManager.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/Class.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDanzmannGameplayMessagesJournal, Log, All);
+
+FDanzmannGameplayMessagesJournalWriter::FDanzmannGameplayMessagesJournalWriter(const FString& Filename, const int32 InChunkSize, const FName InCompressionFormat) :
+	WakeUpEvent(EEventMode::AutoReset),
+	CompressionFormat(InCompressionFormat),
+	ChunkSize(FMath::Max(InChunkSize, 1024))
+{
+	if (!FCompression::IsFormatValid(CompressionFormat))
+	{
+		UE_LOG(LogDanzmannGameplayMessagesJournal, Warning, TEXT("[%hs] Compression format %s isn't available, falling back to Zlib."), __FUNCTION__, *CompressionFormat.ToString());
+		CompressionFormat = NAME_Zlib;
+	}
+
+	File.Reset(IFileManager::Get().CreateFileWriter(*Filename));
+	if (!File.IsValid())
+	{
+		UE_LOG(LogDanzmannGameplayMessagesJournal, Error, TEXT("[%hs] Failed to create journal %s, Gameplay Messages aren't recorded."), __FUNCTION__, *Filename);
+		return;
+	}
+
+	// File archives don't serialize names, compression format is written as a string
+	uint32 Magic = DanzmannGameplayMessages::JournalMagic;
+	int32 Version = DanzmannGameplayMessages::JournalVersion;
+	FString CompressionFormatName = CompressionFormat.ToString();
+	*File << Magic << Version << CompressionFormatName;
+
+	CurrentChunk.Data.Reserve(ChunkSize);
+
+	Thread.Reset(FRunnableThread::Create(this, TEXT("DanzmannGameplayMessagesJournalWriter"), 0, TPri_BelowNormal));
+}
+
+FDanzmannGameplayMessagesJournalWriter::~FDanzmannGameplayMessagesJournalWriter()
+{
+	if (!File.IsValid())
+	{
+		return;
+	}
+
+	SubmitCurrentChunk();
+
+	// Thread writes every chunk left before it's done
+	if (Thread.IsValid())
+	{
+		Thread->Kill(true);
+		Thread.Reset();
+	}
+	else
+	{
+		WritePendingChunks();
+	}
+
+	int64 FooterOffset = File->Tell();
+	uint32 Magic = DanzmannGameplayMessages::JournalMagic;
+	*File << Schemas << ChannelNames << Chunks;
+	*File << FooterOffset << Magic;
+
+	File->Close();
+	File.Reset();
+}
+
+bool FDanzmannGameplayMessagesJournalWriter::Write(const double Time, const uint64 Frame, const FGameplayTag Channel, const FConstStructView GameplayMessage)
+{
+	const UScriptStruct* StructType = GameplayMessage.GetScriptStruct();
+	if (!File.IsValid() || !Channel.IsValid() || (StructType == nullptr) || (GameplayMessage.GetMemory() == nullptr))
+	{
+		return false;
+	}
+
+	int32 SchemaIndex = FindOrAddSchema(StructType);
+	int32 ChannelIndex = FindOrAddChannel(Channel);
+
+	TArray<uint8>& ChunkData = CurrentChunk.Data;
+	const int32 RecordOffset = ChunkData.Num();
+
+	FMemoryWriter Writer(ChunkData, true, true);
+	double RecordTime = Time;
+	uint64 RecordFrame = Frame;
+	Writer << RecordTime << RecordFrame << ChannelIndex << SchemaIndex;
+
+	// Payload size is patched once written, so readers can skip it
+	const int64 SizeOffset = Writer.Tell();
+	int32 PayloadSize = 0;
+	Writer << PayloadSize;
+
+	if (Schemas[SchemaIndex].Encoding == EDanzmannGameplayMessagesJournalEncoding::Raw)
+	{
+		Writer.Serialize(const_cast<uint8*>(GameplayMessage.GetMemory()), StructType->GetStructureSize());
+	}
+	else
+	{
+		FObjectAndNameAsStringProxyArchive ProxyWriter(Writer, false);
+		StructType->SerializeItem(ProxyWriter, const_cast<uint8*>(GameplayMessage.GetMemory()), nullptr);
+	}
+
+	const int64 EndOffset = Writer.Tell();
+	PayloadSize = static_cast<int32>(EndOffset - SizeOffset - sizeof(int32));
+	Writer.Seek(SizeOffset);
+	Writer << PayloadSize;
+	Writer.Seek(EndOffset);
+
+	// Chunks only hold whole records, so a record overflowing its chunk is moved to the next one
+	if ((ChunkData.Num() > ChunkSize) && (RecordOffset > 0))
+	{
+		TArray<uint8> Record(ChunkData.GetData() + RecordOffset, ChunkData.Num() - RecordOffset);
+		ChunkData.SetNum(RecordOffset, EAllowShrinking::No);
+		SubmitCurrentChunk();
+		ChunkData.Append(Record);
+	}
+
+	FDanzmannGameplayMessagesJournalChunk& Chunk = CurrentChunk.Chunk;
+	if (Chunk.NumRecords == 0)
+	{
+		Chunk.FirstTime = Time;
+		Chunk.FirstFrame = Frame;
+	}
+	++Chunk.NumRecords;
+
+	if (ChunkData.Num() >= ChunkSize)
+	{
+		SubmitCurrentChunk();
+	}
+
+	return true;
+}
+
+uint32 FDanzmannGameplayMessagesJournalWriter::Run()
+{
+	while (!bIsStopping.load())
+	{
+		WakeUpEvent->Wait();
+
+		WritePendingChunks();
+	}
+
+	// Chunks submitted until the very end still get out
+	WritePendingChunks();
+
+	return 0;
+}
+
+void FDanzmannGameplayMessagesJournalWriter::Stop()
+{
+	bIsStopping.store(true);
+	WakeUpEvent->Trigger();
+}
+
+void FDanzmannGameplayMessagesJournalWriter::SubmitCurrentChunk()
+{
+	if (CurrentChunk.Chunk.NumRecords == 0)
+	{
+		return;
+	}
+
+	CurrentChunk.Chunk.UncompressedSize = CurrentChunk.Data.Num();
+	PendingChunks.Enqueue(MoveTemp(CurrentChunk));
+	WakeUpEvent->Trigger();
+
+	CurrentChunk = FPendingChunk();
+	CurrentChunk.Data.Reserve(ChunkSize);
+}
+
+void FDanzmannGameplayMessagesJournalWriter::WritePendingChunks()
+{
+	FPendingChunk PendingChunk;
+	while (PendingChunks.Dequeue(PendingChunk))
+	{
+		int32 CompressedSize = FCompression::CompressMemoryBound(CompressionFormat, PendingChunk.Data.Num());
+		CompressedData.SetNumUninitialized(CompressedSize, EAllowShrinking::No);
+		if (!FCompression::CompressMemory(CompressionFormat, CompressedData.GetData(), CompressedSize, PendingChunk.Data.GetData(), PendingChunk.Data.Num()))
+		{
+			UE_LOG(LogDanzmannGameplayMessagesJournal, Error, TEXT("[%hs] Failed to compress chunk of %d Gameplay Messages, they're dropped."), __FUNCTION__, PendingChunk.Chunk.NumRecords);
+			continue;
+		}
+
+		FDanzmannGameplayMessagesJournalChunk& Chunk = Chunks.Add_GetRef(PendingChunk.Chunk);
+		Chunk.Offset = File->Tell();
+		Chunk.CompressedSize = CompressedSize;
+		File->Serialize(CompressedData.GetData(), CompressedSize);
+	}
+}
+
+int32 FDanzmannGameplayMessagesJournalWriter::FindOrAddSchema(const UScriptStruct* StructType)
+{
+	if (const int32* SchemaIndex = SchemaIndices.Find(StructType))
+	{
+		return *SchemaIndex;
+	}
+
+	const int32 SchemaIndex = Schemas.Add(FDanzmannGameplayMessagesJournalSchema::Create(StructType));
+	SchemaIndices.Add(StructType, SchemaIndex);
+
+	return SchemaIndex;
+}
+
+int32 FDanzmannGameplayMessagesJournalWriter::FindOrAddChannel(const FGameplayTag Channel)
+{
+	if (const int32* ChannelIndex = ChannelIndices.Find(Channel))
+	{
+		return *ChannelIndex;
+	}
+
+	const int32 ChannelIndex = ChannelNames.Add(Channel.ToString());
+	ChannelIndices.Add(Channel, ChannelIndex);
+
+	return ChannelIndex;
+}
@@ -0,0 +1,151 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UScriptStruct;
+
+namespace DanzmannGameplayMessages
+{
+	/**
+	 * Journal file identifier and version.
+	 */
+	static constexpr uint32 JournalMagic = 0x44474D4A;
+	static constexpr int32 JournalVersion = 1;
+}
+
+/**
+ * How Gameplay Messages of a struct type are encoded in a journal.
+ */
+enum class EDanzmannGameplayMessagesJournalEncoding : uint8
+{
+	// Memory copied as is, only used for plain old data made of numbers, enums and bools
+	Raw,
+
+	// Tagged properties, with object references written as paths
+	Tagged
+};
+
+/**
+ * Property of a Gameplay Message struct type, as laid out when journal was recorded.
+ */
+struct FDanzmannGameplayMessagesJournalProperty
+{
+	/**
+	 * Property name, nested properties are prefixed by the name of their struct property (e.g., Location.X).
+	 */
+	FString Name;
+
+	/**
+	 * Property C++ type (e.g., float, FVector), used to tell whether a property kept its type.
+	 */
+	FString CPPType;
+
+	/**
+	 * Property offset within Gameplay Message.
+	 */
+	int32 Offset = 0;
+
+	/**
+	 * Property size, along with every element of static arrays.
+	 */
+	int32 Size = 0;
+
+	bool operator==(const FDanzmannGameplayMessagesJournalProperty& Other) const
+	{
+		return (Offset == Other.Offset) && (Size == Other.Size) && (Name == Other.Name) && (CPPType == Other.CPPType);
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FDanzmannGameplayMessagesJournalProperty& Property)
+	{
+		return Ar << Property.Name << Property.CPPType << Property.Offset << Property.Size;
+	}
+};
+
+/**
+ * Schema of a Gameplay Message struct type stored in a journal: its path and property layout. Journals recorded by an older build are replayed
+ * by comparing their schemas against current struct types: identical layouts are copied as is, while raw Gameplay Messages of struct types
+ * that gained or lost properties are remapped property by property. Everything else goes through tagged properties, which handle it on their own.
+ */
+struct DANZMANNGAMEPLAYMESSAGESJOURNAL_API FDanzmannGameplayMessagesJournalSchema
+{
+	/**
+	 * Struct type path.
+	 */
+	FString StructPath;
+
+	/**
+	 * How Gameplay Messages of struct type are encoded.
+	 */
+	EDanzmannGameplayMessagesJournalEncoding Encoding = EDanzmannGameplayMessagesJournalEncoding::Tagged;
+
+	/**
+	 * Struct type size.
+	 */
+	int32 StructureSize = 0;
+
+	/**
+	 * Numeric, enum and bool properties of struct type, nested structs flattened.
+	 */
+	TArray<FDanzmannGameplayMessagesJournalProperty> Properties;
+
+	/**
+	 * Create schema of a struct type, as it's currently laid out.
+	 * @param StructType Struct type.
+	 * @return Schema of struct type.
+	 */
+	static FDanzmannGameplayMessagesJournalSchema Create(const UScriptStruct* StructType);
+
+	/**
+	 * Check whether Gameplay Messages of another schema can be copied as is into this one.
+	 * @param Other Schema to compare against.
+	 * @return Whether both schemas have the same encoding and layout.
+	 */
+	bool HasSameLayout(const FDanzmannGameplayMessagesJournalSchema& Other) const
+	{
+		return (Encoding == Other.Encoding) && (StructureSize == Other.StructureSize) && (Properties == Other.Properties);
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FDanzmannGameplayMessagesJournalSchema& Schema)
+	{
+		uint8 Encoding = static_cast<uint8>(Schema.Encoding);
+		Ar << Schema.StructPath << Encoding << Schema.StructureSize << Schema.Properties;
+		Schema.Encoding = static_cast<EDanzmannGameplayMessagesJournalEncoding>(Encoding);
+
+		return Ar;
+	}
+};
+
+/**
+ * Compressed chunk of a journal, as listed in its chunk index.
+ */
+struct FDanzmannGameplayMessagesJournalChunk
+{
+	/**
+	 * Offset of compressed chunk within journal.
+	 */
+	int64 Offset = 0;
+
+	/**
+	 * Compressed and uncompressed chunk sizes.
+	 */
+	int32 CompressedSize = 0;
+	int32 UncompressedSize = 0;
+
+	/**
+	 * Number of Gameplay Messages in chunk.
+	 */
+	int32 NumRecords = 0;
+
+	/**
+	 * Frame and world time first Gameplay Message of chunk was broadcast at, used to seek.
+	 */
+	uint64 FirstFrame = 0;
+	double FirstTime = 0.0;
+
+	friend FArchive& operator<<(FArchive& Ar, FDanzmannGameplayMessagesJournalChunk& Chunk)
+	{
+		return Ar << Chunk.Offset << Chunk.CompressedSize << Chunk.UncompressedSize << Chunk.NumRecords << Chunk.FirstFrame << Chunk.FirstTime;
+	}
+};
@@ -0,0 +1,168 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "DanzmannGameplayMessagesJournalFormat.h"
+#include "GameplayTagContainer.h"
+#include "StructUtils/InstancedStruct.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class FArchive;
+
+/**
+ * Gameplay Message read from a journal.
+ */
+struct FDanzmannGameplayMessagesJournalRecord
+{
+	/**
+	 * World time Gameplay Message was broadcast at.
+	 */
+	double Time = 0.0;
+
+	/**
+	 * Frame Gameplay Message was broadcast on.
+	 */
+	uint64 Frame = 0;
+
+	/**
+	 * Channel Gameplay Message was broadcast on.
+	 */
+	FGameplayTag Channel;
+
+	/**
+	 * Gameplay Message.
+	 */
+	FInstancedStruct GameplayMessage;
+};
+
+/**
+ * Reader of Gameplay Message journals, meant to replay them (e.g., broadcasting each record read). Chunks are decompressed one at a time,
+ * and any of them can be seeked to through the chunk index. Journals recorded by an older build are read against current struct types:
+ * Gameplay Messages whose struct type kept its layout are copied as is, raw ones whose struct type gained or lost properties are remapped
+ * property by property (by name and type), and tagged ones fall back to tagged property serialization. Records whose channel or struct type
+ * no longer exists are skipped.
+ * @see FDanzmannGameplayMessagesJournalWriter.
+ */
+class DANZMANNGAMEPLAYMESSAGESJOURNAL_API FDanzmannGameplayMessagesJournalReader : public FNoncopyable
+{
+	public:
+		FDanzmannGameplayMessagesJournalReader();
+		~FDanzmannGameplayMessagesJournalReader();
+
+		/**
+		 * Open a journal, reading its footer and positioning reader at its first record.
+		 * @param Filename Journal file.
+		 * @return Whether journal could be opened.
+		 */
+		bool Open(const FString& Filename);
+
+		/**
+		 * Get chunk index of journal.
+		 * @return Chunks of journal, in order.
+		 */
+		const TArray<FDanzmannGameplayMessagesJournalChunk>& GetChunks() const
+		{
+			return Chunks;
+		}
+
+		/**
+		 * Position reader at the first record of a chunk.
+		 * @param ChunkIndex Index of chunk.
+		 * @return Whether chunk could be read.
+		 */
+		bool SeekToChunk(const int32 ChunkIndex);
+
+		/**
+		 * Position reader at the first record broadcast at or after a world time, only decompressing the chunk holding it.
+		 * @param Time World time.
+		 * @return Whether a record was found.
+		 */
+		bool SeekToTime(const double Time);
+
+		/**
+		 * Read next record, skipping the ones that can't be resolved.
+		 * @param OutRecord Record read.
+		 * @return Whether a record was read, false once journal is over.
+		 */
+		bool ReadNext(FDanzmannGameplayMessagesJournalRecord& OutRecord);
+
+	private:
+		/**
+		 * Schema of journal resolved against current struct type.
+		 */
+		struct FResolvedSchema
+		{
+			/**
+			 * Current struct type, invalid if it no longer exists.
+			 */
+			TWeakObjectPtr<const UScriptStruct> StructType;
+
+			/**
+			 * Whether Gameplay Messages can be copied as is.
+			 */
+			bool bHasSameLayout = false;
+
+			/**
+			 * Properties copied from raw Gameplay Messages when layout changed: offset in journal, offset in current struct type and size.
+			 */
+			TArray<FIntVector3> RemappedProperties;
+
+			/**
+			 * Whether schema was resolved.
+			 */
+			bool bIsResolved = false;
+		};
+
+		/**
+		 * Decompress a chunk, positioning reader at its first record.
+		 * @param ChunkIndex Index of chunk.
+		 * @return Whether chunk could be read.
+		 */
+		bool LoadChunk(const int32 ChunkIndex);
+
+		/**
+		 * Resolve a schema of journal against current struct type, the first time one of its Gameplay Messages is read.
+		 * @param SchemaIndex Index of schema.
+		 * @return Resolved schema.
+		 */
+		const FResolvedSchema& ResolveSchema(const int32 SchemaIndex);
+
+		/**
+		 * Decode payload of a record.
+		 * @param SchemaIndex Index of schema of record.
+		 * @param Payload Payload of record.
+		 * @param OutGameplayMessage Decoded Gameplay Message.
+		 * @return Whether payload could be decoded.
+		 */
+		bool DecodePayload(const int32 SchemaIndex, const TConstArrayView<uint8> Payload, FInstancedStruct& OutGameplayMessage);
+
+		/**
+		 * Journal file.
+		 */
+		TUniquePtr<FArchive> File;
+
+		/**
+		 * Compression format of chunks.
+		 */
+		FName CompressionFormat;
+
+		/**
+		 * Schemas, channels and chunk index, read from footer.
+		 */
+		TArray<FDanzmannGameplayMessagesJournalSchema> Schemas;
+		TArray<FResolvedSchema> ResolvedSchemas;
+		TArray<FGameplayTag> Channels;
+		TArray<FDanzmannGameplayMessagesJournalChunk> Chunks;
+
+		/**
+		 * Chunk being read, its decompressed data and offset of next record within it.
+		 */
+		int32 CurrentChunkIndex = INDEX_NONE;
+		TArray<uint8> ChunkData;
+		int32 RecordOffset = 0;
+
+		/**
+		 * Decompression buffer.
+		 */
+		TArray<uint8> CompressedData;
+};
@@ -0,0 +1,61 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "DanzmannGameplayMessagesJournalWriter.h"
+#include "DanzmannScopedGameplayMessageListener.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "DanzmannGameplayMessagesJournalRecorder.generated.h"
+
+/**
+ * Recorder of Gameplay Messages broadcast on selected channels into a compressed journal in Saved/Journals, one per world.
+ * Gameplay Messages are encoded from within the broadcast call, while compression and I/O happen on a background writer thread.
+ * @see UDanzmannGameplayMessagesJournalSettings, FDanzmannGameplayMessagesJournalReader.
+ * @note Native Gameplay Messages have no reflection data, they're not recorded.
+ */
+UCLASS()
+class DANZMANNGAMEPLAYMESSAGESJOURNAL_API UDanzmannGameplayMessagesJournalRecorder : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+	public:
+		/**
+		 * @see more info in USubsystem.
+		 */
+		virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+		/**
+		 * @see more info in UWorldSubsystem.
+		 */
+		virtual void PostInitialize() override;
+
+		/**
+		 * @see more info in USubsystem.
+		 */
+		virtual void Deinitialize() override;
+
+	protected:
+		/**
+		 * @see more info in UWorldSubsystem.
+		 */
+		virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	private:
+		/**
+		 * Write a Gameplay Message broadcast on a recorded channel to journal.
+		 * @param Channel Channel Gameplay Message was broadcast on.
+		 * @param GameplayMessage Gameplay Message.
+		 */
+		void HandleGameplayMessage(const FGameplayTag Channel, const FConstStructView GameplayMessage);
+
+		/**
+		 * Journal writer.
+		 */
+		TUniquePtr<FDanzmannGameplayMessagesJournalWriter> Writer;
+
+		/**
+		 * Listeners of recorded channels.
+		 */
+		TArray<FDanzmannScopedGameplayMessageListener> Listeners;
+};
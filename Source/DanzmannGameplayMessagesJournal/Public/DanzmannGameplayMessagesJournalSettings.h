@@ -0,0 +1,45 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/DeveloperSettings.h"
+#include "GameplayTagContainer.h"
+
+#include "DanzmannGameplayMessagesJournalSettings.generated.h"
+
+/**
+ * Journal recorder settings, found in Project Settings > Plugins > Dancing Man Gameplay Messages Journal.
+ * @see UDanzmannGameplayMessagesJournalRecorder.
+ */
+UCLASS(Config = Game, DefaultConfig, DisplayName = "Dancing Man Gameplay Messages Journal")
+class DANZMANNGAMEPLAYMESSAGESJOURNAL_API UDanzmannGameplayMessagesJournalSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+	public:
+		UDanzmannGameplayMessagesJournalSettings();
+
+		/**
+		 * Whether Gameplay Messages are recorded to a journal in Saved/Journals.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Journal")
+		bool bEnabled = false;
+
+		/**
+		 * Channels recorded, along with their child channels.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Journal")
+		FGameplayTagContainer RecordedChannels;
+
+		/**
+		 * Size of the chunks Gameplay Messages are compressed in, in kilobytes. Bigger chunks compress better, smaller ones are faster to seek into.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Journal", Meta = (ClampMin = 16, ClampMax = 16384, ForceUnits = "KB"))
+		int32 ChunkSizeKB = 256;
+
+		/**
+		 * Compression format of chunks (e.g., Oodle, LZ4, Zlib). Falls back to Zlib if format isn't available.
+		 */
+		UPROPERTY(Config, EditAnywhere, Category = "Journal")
+		FName CompressionFormat = NAME_Oodle;
+};
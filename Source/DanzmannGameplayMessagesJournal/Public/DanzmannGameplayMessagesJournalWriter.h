@@ -0,0 +1,163 @@
+// Copyright (C) 2025 Vicente Danzmann. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Queue.h"
+#include "DanzmannGameplayMessagesJournalFormat.h"
+#include "GameplayTagContainer.h"
+#include "HAL/Event.h"
+#include "HAL/Runnable.h"
+#include "StructUtils/StructView.h"
+#include "UObject/ObjectKey.h"
+
+#include <atomic>
+
+class FArchive;
+class FRunnableThread;
+
+/**
+ * Writer of Gameplay Message journals. Gameplay Messages are encoded on the game thread into fixed-size chunks, which are handed to a background
+ * thread as soon as they're full to be compressed with FCompression and appended to the journal. Once done, a footer is written with the schema
+ * of every struct type, the channel names and the chunk index, so readers can seek to any chunk without decompressing the ones before it.
+ * Journal layout: header (identifier, version, compression format), compressed chunks, footer, then footer offset and identifier.
+ * Each chunk holds whole records: world time, frame, channel index, schema index, payload size and payload.
+ * @see FDanzmannGameplayMessagesJournalReader.
+ * @note Native Gameplay Messages have no reflection data, they can't be written.
+ */
+class DANZMANNGAMEPLAYMESSAGESJOURNAL_API FDanzmannGameplayMessagesJournalWriter : public FRunnable, public FNoncopyable
+{
+	public:
+		/**
+		 * Create journal and start writer thread.
+		 * @param Filename Journal file.
+		 * @param InChunkSize Size of uncompressed chunks, in bytes. Chunks only hold whole records, so a chunk is bigger only if a single record is.
+		 * @param InCompressionFormat Compression format of chunks, falls back to Zlib if format isn't available.
+		 */
+		FDanzmannGameplayMessagesJournalWriter(const FString& Filename, const int32 InChunkSize, const FName InCompressionFormat);
+
+		/**
+		 * Write every chunk left, stop writer thread and write footer.
+		 */
+		virtual ~FDanzmannGameplayMessagesJournalWriter() override;
+
+		/**
+		 * Write a Gameplay Message. Only meant to be called from the game thread.
+		 * @param Time World time Gameplay Message was broadcast at.
+		 * @param Frame Frame Gameplay Message was broadcast on.
+		 * @param Channel Channel Gameplay Message was broadcast on.
+		 * @param GameplayMessage Gameplay Message.
+		 * @return Whether Gameplay Message could be written.
+		 */
+		bool Write(const double Time, const uint64 Frame, const FGameplayTag Channel, const FConstStructView GameplayMessage);
+
+		/**
+		 * Check whether journal could be created.
+		 * @return Whether journal is being written.
+		 */
+		bool IsValid() const
+		{
+			return File.IsValid();
+		}
+
+		/**
+		 * @see more info in FRunnable.
+		 */
+		virtual uint32 Run() override;
+
+		/**
+		 * @see more info in FRunnable.
+		 */
+		virtual void Stop() override;
+
+	private:
+		/**
+		 * Chunk waiting to be compressed.
+		 */
+		struct FPendingChunk
+		{
+			TArray<uint8> Data;
+			FDanzmannGameplayMessagesJournalChunk Chunk;
+		};
+
+		/**
+		 * Hand current chunk to writer thread. Called from the game thread.
+		 */
+		void SubmitCurrentChunk();
+
+		/**
+		 * Compress and write every pending chunk. Called from writer thread.
+		 */
+		void WritePendingChunks();
+
+		/**
+		 * Find index of the schema of a struct type, adding it if it's the first Gameplay Message of its type. Called from the game thread.
+		 * @param StructType Struct type.
+		 * @return Index of schema.
+		 */
+		int32 FindOrAddSchema(const UScriptStruct* StructType);
+
+		/**
+		 * Find index of a channel, adding it if it's the first Gameplay Message on it. Called from the game thread.
+		 * @param Channel Channel.
+		 * @return Index of channel.
+		 */
+		int32 FindOrAddChannel(const FGameplayTag Channel);
+
+		/**
+		 * Chunks waiting to be compressed, pushed by the game thread and popped by writer thread.
+		 */
+		TQueue<FPendingChunk, EQueueMode::Spsc> PendingChunks;
+
+		/**
+		 * Whether writer thread has been asked to stop.
+		 */
+		std::atomic<bool> bIsStopping = false;
+
+		/**
+		 * Triggered whenever a chunk is pending.
+		 */
+		FEventRef WakeUpEvent;
+
+		/**
+		 * Writer thread.
+		 */
+		TUniquePtr<FRunnableThread> Thread;
+
+		/**
+		 * Journal file. Only used by writer thread while it's running.
+		 */
+		TUniquePtr<FArchive> File;
+
+		/**
+		 * Compression format of chunks.
+		 */
+		FName CompressionFormat;
+
+		/**
+		 * Size of uncompressed chunks.
+		 */
+		int32 ChunkSize = 0;
+
+		/**
+		 * Chunk being filled. Only used by the game thread.
+		 */
+		FPendingChunk CurrentChunk;
+
+		/**
+		 * Schemas and their index by struct type. Only used by the game thread.
+		 */
+		TArray<FDanzmannGameplayMessagesJournalSchema> Schemas;
+		TMap<FObjectKey, int32> SchemaIndices;
+
+		/**
+		 * Channel names and their index by channel. Only used by the game thread.
+		 */
+		TArray<FString> ChannelNames;
+		TMap<FGameplayTag, int32> ChannelIndices;
+
+		/**
+		 * Compressed chunks written so far and compression buffer. Only used by writer thread.
+		 */
+		TArray<FDanzmannGameplayMessagesJournalChunk> Chunks;
+		TArray<uint8> CompressedData;
+};